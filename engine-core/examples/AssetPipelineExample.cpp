@@ -6,6 +6,7 @@
 #include "Assets/Model.h"
 #include "Assets/Material.h"
 #include "Rendering/Shader.h"
+#include "Physics/ConvexDecomposition.h"
 
 using namespace YUGA;
 
@@ -22,6 +23,12 @@ void AssetPipelineExample() {
         
         // Draw the model (automatically uses its materials)
         model->Draw();
+        
+        // Bake the convex hulls for ConvexMesh colliders next to the model
+        // (character.fbx.hulls); PhysicsSystem only reads them at runtime
+        if (!ConvexDecomposition::BuildCache(*model)) {
+            LOG_WARN("Could not build the convex hull cache for {}", model->GetPath());
+        }
     }
 
     // ===== LOADING TEXTURES =====
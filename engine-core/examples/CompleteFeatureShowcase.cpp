@@ -113,11 +113,11 @@ private:
     std::vector<Light> lights;
     
     // UI Components
-    std::shared_ptr<ModernButton> playButton;
-    std::shared_ptr<ProgressBar> healthBar;
-    std::shared_ptr<Notification> notification;
-    std::shared_ptr<ModernWindow> settingsWindow;
-    std::shared_ptr<LoadingSpinner> spinner;
+    Ref<ModernButton> playButton;
+    Ref<ProgressBar> healthBar;
+    Ref<Notification> notification;
+    Ref<ModernWindow> settingsWindow;
+    Ref<LoadingSpinner> spinner;
     
     // Game state
     Transform playerTransform;
@@ -172,7 +172,7 @@ private:
         UITheme theme = UITheme::Dark();
         
         // 1. Play Button
-        playButton = std::make_shared<ModernButton>("▶ Play Game");
+        playButton = CreateRef<ModernButton>("▶ Play Game");
         playButton->position = Vector2(50, 50);
         playButton->size = Vector2(150, 50);
         playButton->normalColor = theme.primaryColor;
@@ -183,7 +183,7 @@ private:
         uiCanvas->AddElement(playButton);
         
         // 2. Health Bar
-        healthBar = std::make_shared<ProgressBar>();
+        healthBar = CreateRef<ProgressBar>();
         healthBar->position = Vector2(50, 120);
         healthBar->size = Vector2(300, 30);
         healthBar->targetValue = 0.75f;
@@ -192,7 +192,7 @@ private:
         uiCanvas->AddElement(healthBar);
         
         // 3. Settings Window
-        settingsWindow = std::make_shared<ModernWindow>("⚙ Settings");
+        settingsWindow = CreateRef<ModernWindow>("⚙ Settings");
         settingsWindow->position = Vector2(1500, 100);
         settingsWindow->size = Vector2(350, 500);
         settingsWindow->titleBarColor = theme.surfaceColor;
@@ -201,7 +201,7 @@ private:
         uiCanvas->AddElement(settingsWindow);
         
         // 4. Loading Spinner
-        spinner = std::make_shared<LoadingSpinner>();
+        spinner = CreateRef<LoadingSpinner>();
         spinner->position = Vector2(900, 500);
         spinner->size = Vector2(64, 64);
         spinner->color = theme.primaryColor;
@@ -209,14 +209,14 @@ private:
         uiCanvas->AddElement(spinner);
         
         // 5. FPS Counter
-        auto fpsText = std::make_shared<ModernText>("FPS: 60");
+        auto fpsText = CreateRef<ModernText>("FPS: 60");
         fpsText->position = Vector2(1800, 20);
         fpsText->fontSize = 16.0f;
         fpsText->color = theme.textColor;
         uiCanvas->AddElement(fpsText);
         
         // 6. Slider
-        auto volumeSlider = std::make_shared<Slider>(0.0f, 1.0f);
+        auto volumeSlider = CreateRef<Slider>(0.0f, 1.0f);
         volumeSlider->position = Vector2(50, 200);
         volumeSlider->value = 0.8f;
         volumeSlider->showValue = true;
@@ -226,7 +226,7 @@ private:
         uiCanvas->AddElement(volumeSlider);
         
         // 7. Checkbox
-        auto fullscreenCheck = std::make_shared<Checkbox>("Fullscreen");
+        auto fullscreenCheck = CreateRef<Checkbox>("Fullscreen");
         fullscreenCheck->position = Vector2(50, 250);
         fullscreenCheck->onChanged = [this](bool checked) {
             window->SetFullscreen(checked);
@@ -234,7 +234,7 @@ private:
         uiCanvas->AddElement(fullscreenCheck);
         
         // 8. Dropdown
-        auto qualityDropdown = std::make_shared<Dropdown>();
+        auto qualityDropdown = CreateRef<Dropdown>();
         qualityDropdown->position = Vector2(50, 300);
         qualityDropdown->AddItem("Low");
         qualityDropdown->AddItem("Medium");
@@ -346,7 +346,7 @@ private:
     }
     
     void ShowNotification(const std::string& message, Notification::Type type) {
-        auto notif = std::make_shared<Notification>(message, type);
+        auto notif = CreateRef<Notification>(message, type);
         notif->position = Vector2(1920 - 320, 50);
         notif->duration = 3.0f;
         uiCanvas->AddElement(notif);
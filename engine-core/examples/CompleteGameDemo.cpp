@@ -163,14 +163,14 @@ private:
         ui = std::make_unique<UICanvas>(1920, 1080);
         
         // Score text
-        auto scoreText = std::make_shared<UIText>();
+        auto scoreText = CreateRef<UIText>();
         scoreText->text = "Score: 0";
         scoreText->position = Vector2(10, 10);
         scoreText->fontSize = 24.0f;
         ui->AddElement(scoreText);
         
         // Health bar
-        auto healthBar = std::make_shared<UIImage>();
+        auto healthBar = CreateRef<UIImage>();
         healthBar->position = Vector2(10, 50);
         healthBar->size = Vector2(200, 20);
         healthBar->color = Vector4(1, 0, 0, 1);
@@ -0,0 +1,349 @@
+/**
+ * YUGA Engine - Headless Physics Benchmark
+ *
+ * Steps reproducible scenes at increasing body counts and records the
+ * per-step phase timings PhysicsWorld publishes in PhysicsStats.
+ *
+ *   PhysicsBenchmark [--scene stack|pile|ragdoll|mixed|all]
+ *                    [--bodies 1000,5000,10000,50000]
+ *                    [--steps 300] [--warmup 30] [--mt]
+ *                    [--csv physics_benchmark.csv]
+ *
+ * Every measured step is written to the CSV; a per-run summary goes to stdout.
+ * The threads column is what the world ran with, so a --mt run that fell
+ * back to one thread shows as such.
+ */
+
+#include "Core/JobSystem.h"
+#include "Memory/MemoryTracker.h"
+#include "Physics/PhysicsWorld.h"
+#include "Physics/RigidBody.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace YUGA;
+
+namespace {
+
+struct BenchmarkOptions {
+    std::vector<std::string> scenes{ "stack", "pile", "ragdoll", "mixed" };
+    std::vector<uint32_t> bodyCounts{ 1000, 5000, 10000, 50000 };
+    uint32_t steps = 300;
+    uint32_t warmup = 30;
+    bool multithreaded = false;
+    std::string csvPath = "physics_benchmark.csv";
+};
+
+// Bodies and joints of one scene; joints go before the world does
+struct BenchmarkScene {
+    std::vector<Ref<RigidBody>> bodies;
+    std::vector<btTypedConstraint*> constraints;
+};
+
+constexpr float StepTime = 1.0f / 60.0f;
+constexpr uint32_t StackHeight = 10;
+constexpr uint32_t RagdollLinks = 10;
+
+std::vector<std::string> Split(const std::string& text) {
+    std::vector<std::string> parts;
+    size_t start = 0;
+    while (start <= text.size()) {
+        size_t end = text.find(',', start);
+        if (end == std::string::npos) {
+            end = text.size();
+        }
+        if (end > start) {
+            parts.push_back(text.substr(start, end - start));
+        }
+        start = end + 1;
+    }
+    return parts;
+}
+
+bool ParseOptions(int argc, char** argv, BenchmarkOptions& options) {
+    for (int i = 1; i < argc; ++i) {
+        const char* arg = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+
+        if (std::strcmp(arg, "--mt") == 0) {
+            options.multithreaded = true;
+        } else if (!value) {
+            std::fprintf(stderr, "Missing value for %s\n", arg);
+            return false;
+        } else if (std::strcmp(arg, "--scene") == 0) {
+            if (std::strcmp(value, "all") != 0) {
+                options.scenes = Split(value);
+            }
+            ++i;
+        } else if (std::strcmp(arg, "--bodies") == 0) {
+            options.bodyCounts.clear();
+            for (const std::string& count : Split(value)) {
+                options.bodyCounts.push_back(static_cast<uint32_t>(std::strtoul(count.c_str(), nullptr, 10)));
+            }
+            ++i;
+        } else if (std::strcmp(arg, "--steps") == 0) {
+            options.steps = static_cast<uint32_t>(std::strtoul(value, nullptr, 10));
+            ++i;
+        } else if (std::strcmp(arg, "--warmup") == 0) {
+            options.warmup = static_cast<uint32_t>(std::strtoul(value, nullptr, 10));
+            ++i;
+        } else if (std::strcmp(arg, "--csv") == 0) {
+            options.csvPath = value;
+            ++i;
+        } else {
+            std::fprintf(stderr, "Unknown option %s\n", arg);
+            return false;
+        }
+    }
+    return options.steps > 0;
+}
+
+Ref<RigidBody> AddBody(PhysicsWorld& world, BenchmarkScene& scene, CollisionShape shape,
+                       float mass, const Vector3& size, const Vector3& position) {
+    Ref<RigidBody> body = CreateRef<RigidBody>(shape, mass, size);
+    body->SetPosition(position);
+    world.AddRigidBody(body.get());
+    scene.bodies.push_back(body);
+    return body;
+}
+
+// Square footprint holding `count` items at `spacing`
+uint32_t GridSide(uint32_t count) {
+    return std::max(1u, static_cast<uint32_t>(std::ceil(std::sqrt(static_cast<float>(count)))));
+}
+
+// Columns of unit boxes resting on each other: long-lived contacts, deep islands
+void BuildStack(PhysicsWorld& world, BenchmarkScene& scene, uint32_t bodyCount) {
+    uint32_t columns = (bodyCount + StackHeight - 1) / StackHeight;
+    uint32_t side = GridSide(columns);
+    float offset = side * 1.0f;
+
+    uint32_t placed = 0;
+    for (uint32_t column = 0; column < columns && placed < bodyCount; ++column) {
+        float x = (column % side) * 2.0f - offset;
+        float z = (column / side) * 2.0f - offset;
+        for (uint32_t level = 0; level < StackHeight && placed < bodyCount; ++level, ++placed) {
+            AddBody(world, scene, CollisionShape::Box, 1.0f, Vector3(1.0f, 1.0f, 1.0f),
+                    Vector3(x, 0.5f + level * 1.0f, z));
+        }
+    }
+}
+
+// Boxes and spheres dropped in jittered layers: heavy broadphase churn
+void BuildPile(PhysicsWorld& world, BenchmarkScene& scene, uint32_t bodyCount, std::mt19937& rng) {
+    std::uniform_real_distribution<float> jitter(-0.3f, 0.3f);
+    uint32_t layerSize = std::min(bodyCount, 1024u);
+    uint32_t side = GridSide(layerSize);
+    float offset = side * 0.75f;
+
+    for (uint32_t i = 0; i < bodyCount; ++i) {
+        uint32_t layer = i / layerSize;
+        uint32_t cell = i % layerSize;
+        Vector3 position((cell % side) * 1.5f - offset + jitter(rng),
+                         2.0f + layer * 1.5f,
+                         (cell / side) * 1.5f - offset + jitter(rng));
+        CollisionShape shape = (i & 1) ? CollisionShape::Sphere : CollisionShape::Box;
+        AddBody(world, scene, shape, 1.0f, Vector3(1.0f, 1.0f, 1.0f), position);
+    }
+}
+
+// Hanging capsule chains joined point-to-point: constraint-heavy solver load
+void BuildRagdoll(PhysicsWorld& world, BenchmarkScene& scene, uint32_t bodyCount) {
+    const Vector3 linkSize(0.3f, 0.6f, 0.3f);
+    const float linkLength = linkSize.y + linkSize.x;   // Cylinder plus both caps
+    uint32_t chains = (bodyCount + RagdollLinks - 1) / RagdollLinks;
+    uint32_t side = GridSide(chains);
+    float offset = side * 1.0f;
+
+    uint32_t placed = 0;
+    for (uint32_t chain = 0; chain < chains && placed < bodyCount; ++chain) {
+        float x = (chain % side) * 2.0f - offset;
+        float z = (chain / side) * 2.0f - offset;
+        float top = 2.0f + RagdollLinks * linkLength;
+
+        RigidBody* previous = nullptr;
+        for (uint32_t link = 0; link < RagdollLinks && placed < bodyCount; ++link, ++placed) {
+            Ref<RigidBody> body = AddBody(world, scene, CollisionShape::Capsule, 1.0f, linkSize,
+                                          Vector3(x, top - link * linkLength, z));
+            if (previous) {
+                auto* joint = new btPoint2PointConstraint(
+                    *previous->GetBulletBody(), *body->GetBulletBody(),
+                    btVector3(0.0f, -linkLength * 0.5f, 0.0f), btVector3(0.0f, linkLength * 0.5f, 0.0f));
+                world.GetWorld()->addConstraint(joint, true);
+                scene.constraints.push_back(joint);
+            }
+            previous = body.get();
+        }
+    }
+}
+
+// Static obstacles with dynamic bodies raining onto them: mostly static pairs
+void BuildMixed(PhysicsWorld& world, BenchmarkScene& scene, uint32_t bodyCount, std::mt19937& rng) {
+    std::uniform_real_distribution<float> jitter(-0.4f, 0.4f);
+    uint32_t staticCount = bodyCount / 2;
+    uint32_t dynamicCount = bodyCount - staticCount;
+
+    uint32_t staticSide = GridSide(staticCount);
+    float staticOffset = staticSide * 1.5f;
+    for (uint32_t i = 0; i < staticCount; ++i) {
+        CollisionShape shape = (i % 3 == 0) ? CollisionShape::Sphere : CollisionShape::Box;
+        AddBody(world, scene, shape, 0.0f, Vector3(2.0f, 1.0f, 2.0f),
+                Vector3((i % staticSide) * 3.0f - staticOffset, 0.5f, (i / staticSide) * 3.0f - staticOffset));
+    }
+
+    uint32_t layerSize = std::min(std::max(dynamicCount, 1u), 1024u);
+    uint32_t side = GridSide(layerSize);
+    float offset = side * 1.5f;
+    for (uint32_t i = 0; i < dynamicCount; ++i) {
+        uint32_t layer = i / layerSize;
+        uint32_t cell = i % layerSize;
+        CollisionShape shape = static_cast<CollisionShape>(i % 3);   // Box, Sphere, Capsule
+        AddBody(world, scene, shape, 1.0f, Vector3(0.8f, 0.8f, 0.8f),
+                Vector3((cell % side) * 3.0f - offset + jitter(rng),
+                        3.0f + layer * 2.0f,
+                        (cell / side) * 3.0f - offset + jitter(rng)));
+    }
+}
+
+struct RunSummary {
+    std::vector<float> stepMs;
+    double broadphaseMs = 0.0;
+    double narrowphaseMs = 0.0;
+    double solverMs = 0.0;
+};
+
+float Percentile(std::vector<float> values, float fraction) {
+    if (values.empty()) {
+        return 0.0f;
+    }
+    size_t index = std::min(values.size() - 1, static_cast<size_t>(fraction * (values.size() - 1) + 0.5f));
+    std::nth_element(values.begin(), values.begin() + index, values.end());
+    return values[index];
+}
+
+void RunScenario(const std::string& sceneName, uint32_t bodyCount, const BenchmarkOptions& options, FILE* csv) {
+    PhysicsWorldConfig config;
+    config.Multithreaded = options.multithreaded;
+
+    PhysicsWorld world;
+    world.Initialize(config);
+    if (options.multithreaded && !world.IsMultithreaded()) {
+        std::fprintf(stderr, "%s/%u: multithreaded world unavailable, running single-threaded\n",
+                     sceneName.c_str(), bodyCount);
+    }
+
+    BenchmarkScene scene;
+    std::mt19937 rng(1337u + bodyCount);
+    AddBody(world, scene, CollisionShape::Box, 0.0f, Vector3(1000.0f, 1.0f, 1000.0f), Vector3(0.0f, -0.5f, 0.0f));
+
+    if (sceneName == "stack") {
+        BuildStack(world, scene, bodyCount);
+    } else if (sceneName == "pile") {
+        BuildPile(world, scene, bodyCount, rng);
+    } else if (sceneName == "ragdoll") {
+        BuildRagdoll(world, scene, bodyCount);
+    } else if (sceneName == "mixed") {
+        BuildMixed(world, scene, bodyCount, rng);
+    } else {
+        std::fprintf(stderr, "Unknown scene '%s'\n", sceneName.c_str());
+        world.Shutdown();
+        return;
+    }
+
+    for (uint32_t i = 0; i < options.warmup; ++i) {
+        world.Update(StepTime);
+    }
+
+    RunSummary summary;
+    summary.stepMs.reserve(options.steps);
+    for (uint32_t step = 0; step < options.steps; ++step) {
+        world.Update(StepTime);
+        const PhysicsStats& stats = world.GetStats();
+
+        summary.stepMs.push_back(stats.StepMilliseconds);
+        summary.broadphaseMs += stats.BroadphaseMilliseconds;
+        summary.narrowphaseMs += stats.NarrowphaseMilliseconds;
+        summary.solverMs += stats.SolverMilliseconds;
+
+        if (csv) {
+            std::fprintf(csv, "%s,%u,%u,%u,%.4f,%.4f,%.4f,%.4f,%u,%u,%u,%u,%u,%u,%zu\n",
+                         sceneName.c_str(), bodyCount, stats.Threads, step,
+                         stats.StepMilliseconds, stats.BroadphaseMilliseconds,
+                         stats.NarrowphaseMilliseconds, stats.SolverMilliseconds,
+                         stats.ActiveBodies, stats.ActiveIslands, stats.LargestIsland,
+                         stats.Manifolds, stats.ContactPoints, stats.Constraints,
+                         MemoryTracker::GetStats(MemoryTag::Physics).liveBytes);
+        }
+    }
+
+    double count = static_cast<double>(options.steps);
+    double meanStep = 0.0;
+    for (float ms : summary.stepMs) {
+        meanStep += ms;
+    }
+    meanStep /= count;
+
+    std::printf("%-8s %6u bodies %2u threads | step mean %7.3f p50 %7.3f p95 %7.3f max %7.3f ms"
+                " | broad %6.3f narrow %6.3f solver %6.3f ms\n",
+                sceneName.c_str(), bodyCount, world.GetStats().Threads, meanStep,
+                Percentile(summary.stepMs, 0.5f), Percentile(summary.stepMs, 0.95f),
+                *std::max_element(summary.stepMs.begin(), summary.stepMs.end()),
+                summary.broadphaseMs / count, summary.narrowphaseMs / count, summary.solverMs / count);
+
+    // Joints reference the bodies, so they leave the world first
+    for (btTypedConstraint* constraint : scene.constraints) {
+        world.GetWorld()->removeConstraint(constraint);
+        delete constraint;
+    }
+    scene.constraints.clear();
+    world.Shutdown();
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    BenchmarkOptions options;
+    if (!ParseOptions(argc, argv, options)) {
+        std::fprintf(stderr, "Usage: PhysicsBenchmark [--scene stack|pile|ragdoll|mixed|all] [--bodies N,N,...]"
+                             " [--steps N] [--warmup N] [--mt] [--csv path]\n");
+        return 1;
+    }
+
+    if (options.multithreaded) {
+        JobSystem::Initialize();
+    }
+    // Without the hooks the world stays single-threaded and Bullet's
+    // allocations miss physics_bytes
+    PhysicsWorld::InstallGlobalHooks();
+
+    FILE* csv = options.csvPath.empty() ? nullptr : std::fopen(options.csvPath.c_str(), "w");
+    if (csv) {
+        std::fprintf(csv, "scene,bodies,threads,step,step_ms,broadphase_ms,narrowphase_ms,solver_ms,"
+                          "active_bodies,active_islands,largest_island,manifolds,contacts,constraints,"
+                          "physics_bytes\n");
+    } else if (!options.csvPath.empty()) {
+        std::fprintf(stderr, "Could not open %s, writing summary only\n", options.csvPath.c_str());
+    }
+
+    for (const std::string& sceneName : options.scenes) {
+        for (uint32_t bodyCount : options.bodyCounts) {
+            RunScenario(sceneName, bodyCount, options, csv);
+        }
+    }
+
+    if (csv) {
+        std::fclose(csv);
+        std::printf("Per-step results written to %s\n", options.csvPath.c_str());
+    }
+
+    if (options.multithreaded) {
+        JobSystem::Shutdown();
+    }
+    return 0;
+}
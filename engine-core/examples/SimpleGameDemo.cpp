@@ -212,18 +212,18 @@ private:
     std::shared_ptr<PhysicsWorld> m_PhysicsWorld;
     std::shared_ptr<AudioEngine> m_AudioEngine;
     std::shared_ptr<Scene> m_Scene;
-    std::shared_ptr<Shader> m_Shader;
+    Ref<Shader> m_Shader;
 
     // Materials
-    std::shared_ptr<Material> m_GroundMaterial;
-    std::shared_ptr<Material> m_PlayerMaterial;
-    std::shared_ptr<Material> m_CollectibleMaterial;
-    std::shared_ptr<Material> m_EnemyMaterial;
+    Ref<Material> m_GroundMaterial;
+    Ref<Material> m_PlayerMaterial;
+    Ref<Material> m_CollectibleMaterial;
+    Ref<Material> m_EnemyMaterial;
 
     // Models
-    std::shared_ptr<Model> m_PlayerModel;
-    std::shared_ptr<Model> m_GroundModel;
-    std::shared_ptr<Model> m_CollectibleModel;
+    Ref<Model> m_PlayerModel;
+    Ref<Model> m_GroundModel;
+    Ref<Model> m_CollectibleModel;
 
     // Physics bodies
     std::shared_ptr<RigidBody> m_PlayerBody;
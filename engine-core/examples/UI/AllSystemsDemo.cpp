@@ -32,7 +32,7 @@ int main() {
     // 3. UI System
     LOG_INFO("\n[3/5] UI System");
     UICanvas canvas(1920, 1080);
-    auto button = std::make_shared<UIButton>();
+    auto button = CreateRef<UIButton>();
     button->text = "Start Game";
     canvas.AddElement(button);
     LOG_INFO("✓ UI canvas created");
@@ -5,6 +5,8 @@
 #include <memory>
 #include "Math/Vector3.h"
 #include "Math/Quaternion.h"
+#include "Memory/MemoryTracker.h"
+#include "Core/Name.h"
 
 namespace YUGA {
 
@@ -34,7 +36,7 @@ struct BoneAnimation {
 };
 
 struct AnimationClip {
-    std::string name;
+    Name name;
     float duration;
     bool looping;
     std::vector<BoneAnimation> boneAnimations;
@@ -42,6 +44,15 @@ struct AnimationClip {
     AnimationClip() : duration(0.0f), looping(true) {}
 };
 
+class AnimationController;
+
+// Published on the EventBus when playback crosses an event added with AddEvent()
+struct AnimationNotifyEvent {
+    const AnimationController* controller;
+    Name clipName;
+    Name eventName;
+};
+
 enum class AnimationState {
     Idle,
     Playing,
@@ -51,9 +62,9 @@ enum class AnimationState {
 
 // State machine for animation transitions
 struct AnimationTransition {
-    std::string fromState;
-    std::string toState;
-    std::string condition;
+    Name fromState;
+    Name toState;
+    Name condition;
     float blendTime;
     
     AnimationTransition() : blendTime(0.3f) {}
@@ -61,29 +72,29 @@ struct AnimationTransition {
 
 class AnimationStateMachine {
 public:
-    void AddState(const std::string& name, const std::string& clipName);
+    void AddState(Name name, Name clipName);
     void AddTransition(const AnimationTransition& transition);
-    void SetParameter(const std::string& name, bool value);
-    void SetParameter(const std::string& name, float value);
+    void SetParameter(Name name, bool value);
+    void SetParameter(Name name, float value);
     
-    std::string GetCurrentState() const { return currentState; }
-    std::string GetTargetClip() const;
+    Name GetCurrentState() const { return currentState; }
+    Name GetTargetClip() const;
     
     void Update(float deltaTime);
     
 private:
-    std::string currentState;
-    std::unordered_map<std::string, std::string> stateToClip;
+    Name currentState;
+    std::unordered_map<Name, Name> stateToClip;
     std::vector<AnimationTransition> transitions;
-    std::unordered_map<std::string, bool> boolParameters;
-    std::unordered_map<std::string, float> floatParameters;
+    std::unordered_map<Name, bool> boolParameters;
+    std::unordered_map<Name, float> floatParameters;
     
-    bool EvaluateCondition(const std::string& condition) const;
+    bool EvaluateCondition(Name condition) const;
 };
 
 // Blend tree for smooth animation blending
 struct BlendNode {
-    std::string clipName;
+    Name clipName;
     float weight;
     Vector2 position; // For 2D blend spaces
     
@@ -95,7 +106,7 @@ public:
     void AddNode(const BlendNode& node);
     void SetBlendParameter(float x, float y = 0.0f);
     
-    std::vector<std::pair<std::string, float>> GetActiveClips() const;
+    std::vector<std::pair<Name, float>> GetActiveClips() const;
     
 private:
     std::vector<BlendNode> nodes;
@@ -111,20 +122,20 @@ public:
     
     // Skeleton
     void SetSkeleton(const std::vector<Bone>& bones);
-    const std::vector<Bone>& GetSkeleton() const { return skeleton; }
+    const TrackedVector<Bone, MemoryTag::Animation>& GetSkeleton() const { return skeleton; }
     
     // Clip management
-    void AddClip(const std::string& name, const AnimationClip& clip);
-    void RemoveClip(const std::string& name);
-    bool HasClip(const std::string& name) const;
-    AnimationClip* GetClip(const std::string& name);
+    void AddClip(Name name, const AnimationClip& clip);
+    void RemoveClip(Name name);
+    bool HasClip(Name name) const;
+    AnimationClip* GetClip(Name name);
     
     // Playback control
-    void Play(const std::string& clipName, float fadeTime = 0.0f);
+    void Play(Name clipName, float fadeTime = 0.0f);
     void Stop();
     void Pause();
     void Resume();
-    void CrossFade(const std::string& clipName, float fadeTime);
+    void CrossFade(Name clipName, float fadeTime);
     
     // Update
     void Update(float deltaTime);
@@ -133,7 +144,7 @@ public:
     AnimationState GetState() const { return state; }
     float GetCurrentTime() const { return currentTime; }
     float GetNormalizedTime() const;
-    const std::string& GetCurrentClip() const { return currentClipName; }
+    Name GetCurrentClip() const { return currentClipName; }
     
     // Settings
     void SetSpeed(float speed) { playbackSpeed = speed; }
@@ -154,21 +165,21 @@ public:
     BlendTree& GetBlendTree() { return blendTree; }
     void EnableBlendTree(bool enable) { useBlendTree = enable; }
     
-    // Events
-    void AddEvent(const std::string& clipName, float time, const std::string& eventName);
-    void SetEventCallback(void (*callback)(const std::string& eventName));
+    // Events (delivered as AnimationNotifyEvent through the EventBus)
+    void AddEvent(Name clipName, float time, Name eventName);
     
 private:
-    std::vector<Bone> skeleton;
-    std::unordered_map<std::string, AnimationClip> clips;
-    std::string currentClipName;
+    TrackedVector<Bone, MemoryTag::Animation> skeleton;
+    std::unordered_map<Name, AnimationClip, std::hash<Name>, std::equal_to<Name>,
+                       TrackedAllocator<std::pair<const Name, AnimationClip>, MemoryTag::Animation>> clips;
+    Name currentClipName;
     AnimationState state;
     float currentTime;
     float playbackSpeed;
     bool looping;
     
     // Blending
-    std::string nextClipName;
+    Name nextClipName;
     float blendTime;
     float blendDuration;
     
@@ -180,16 +191,15 @@ private:
     
     // Events
     struct AnimationEvent {
-        std::string clipName;
+        Name clipName;
         float time;
-        std::string eventName;
+        Name eventName;
         bool triggered;
     };
     std::vector<AnimationEvent> events;
-    void (*eventCallback)(const std::string& eventName);
     
-    void SampleClip(const AnimationClip& clip, float time, std::vector<Vector3>& positions, 
-                    std::vector<Quaternion>& rotations, std::vector<Vector3>& scales) const;
+    void SampleClip(const AnimationClip& clip, float time, Vector3* positions, 
+                    Quaternion* rotations, Vector3* scales) const;
     void BlendTransforms(const Vector3& pos1, const Quaternion& rot1, const Vector3& scale1,
                         const Vector3& pos2, const Quaternion& rot2, const Vector3& scale2,
                         float blend, Vector3& outPos, Quaternion& outRot, Vector3& outScale) const;
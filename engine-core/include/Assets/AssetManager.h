@@ -1,6 +1,8 @@
 #pragma once
 
 #include "Core/Core.h"
+#include "Core/Handle.h"
+#include "Core/Name.h"
 #include "Assets/Model.h"
 #include "Assets/Texture.h"
 #include "Assets/Material.h"
@@ -11,39 +13,52 @@
 
 namespace YUGA {
 
+    using ModelHandle = Handle<Model>;
+    using TextureHandle = Handle<Texture>;
+    using MaterialHandle = Handle<Material>;
+    using ShaderHandle = Handle<Shader>;
+
     class AssetManager {
     public:
         static AssetManager& Get();
 
         // Model management
-        std::shared_ptr<Model> LoadModel(const std::string& path);
-        std::shared_ptr<Model> GetModel(const std::string& path);
-        void UnloadModel(const std::string& path);
+        Ref<Model> LoadModel(const std::string& path);
+        Ref<Model> GetModel(Name path);
+        ModelHandle GetModelHandle(Name path) const;
+        Model* GetModel(ModelHandle handle) const { return m_Models.Resolve(handle); }
+        void UnloadModel(Name path);
 
         // Texture management
-        std::shared_ptr<Texture> LoadTexture(const std::string& path, TextureType type = TextureType::Diffuse);
-        std::shared_ptr<Texture> GetTexture(const std::string& path);
-        void UnloadTexture(const std::string& path);
+        Ref<Texture> LoadTexture(const std::string& path, TextureType type = TextureType::Diffuse);
+        Ref<Texture> GetTexture(Name path);
+        TextureHandle GetTextureHandle(Name path) const;
+        Texture* GetTexture(TextureHandle handle) const { return m_Textures.Resolve(handle); }
+        void UnloadTexture(Name path);
 
         // Material management
-        std::shared_ptr<Material> CreateMaterial(const std::string& name);
-        std::shared_ptr<Material> GetMaterial(const std::string& name);
-        void UnloadMaterial(const std::string& name);
+        Ref<Material> CreateMaterial(const std::string& name);
+        Ref<Material> GetMaterial(Name name);
+        MaterialHandle GetMaterialHandle(Name name) const;
+        Material* GetMaterial(MaterialHandle handle) const { return m_Materials.Resolve(handle); }
+        void UnloadMaterial(Name name);
 
         // Shader management
-        std::shared_ptr<Shader> LoadShader(const std::string& name, const std::string& vertexPath, const std::string& fragmentPath);
-        std::shared_ptr<Shader> GetShader(const std::string& name);
-        void UnloadShader(const std::string& name);
+        Ref<Shader> LoadShader(const std::string& name, const std::string& vertexPath, const std::string& fragmentPath);
+        Ref<Shader> GetShader(Name name);
+        ShaderHandle GetShaderHandle(Name name) const;
+        Shader* GetShader(ShaderHandle handle) const { return m_Shaders.Resolve(handle); }
+        void UnloadShader(Name name);
 
         // Cleanup
         void UnloadAll();
         void UnloadUnused(); // Unload assets with only 1 reference (only AssetManager holds it)
 
         // Statistics
-        size_t GetModelCount() const { return m_Models.size(); }
-        size_t GetTextureCount() const { return m_Textures.size(); }
-        size_t GetMaterialCount() const { return m_Materials.size(); }
-        size_t GetShaderCount() const { return m_Shaders.size(); }
+        size_t GetModelCount() const { return m_Models.GetCount(); }
+        size_t GetTextureCount() const { return m_Textures.GetCount(); }
+        size_t GetMaterialCount() const { return m_Materials.GetCount(); }
+        size_t GetShaderCount() const { return m_Shaders.GetCount(); }
 
     private:
         AssetManager() = default;
@@ -51,10 +66,17 @@ namespace YUGA {
         AssetManager(const AssetManager&) = delete;
         AssetManager& operator=(const AssetManager&) = delete;
 
-        std::unordered_map<std::string, std::shared_ptr<Model>> m_Models;
-        std::unordered_map<std::string, std::shared_ptr<Texture>> m_Textures;
-        std::unordered_map<std::string, std::shared_ptr<Material>> m_Materials;
-        std::unordered_map<std::string, std::shared_ptr<Shader>> m_Shaders;
+        // Assets live in dense slot arrays; the lookup maps are only used to
+        // find a handle by interned path/name at load time.
+        HandlePool<Model> m_Models;
+        HandlePool<Texture> m_Textures;
+        HandlePool<Material> m_Materials;
+        HandlePool<Shader> m_Shaders;
+
+        std::unordered_map<Name, ModelHandle> m_ModelLookup;
+        std::unordered_map<Name, TextureHandle> m_TextureLookup;
+        std::unordered_map<Name, MaterialHandle> m_MaterialLookup;
+        std::unordered_map<Name, ShaderHandle> m_ShaderLookup;
     };
 
 } // namespace YUGA
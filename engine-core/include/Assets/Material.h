@@ -20,13 +20,15 @@ namespace YUGA {
         float Opacity = 1.0f;
     };
 
-    class Material {
+    class Material : public RefCounted {
     public:
+        static constexpr MemoryTag PoolTag = MemoryTag::Assets;
+
         Material(const std::string& name = "Default Material");
         ~Material();
 
-        void SetShader(std::shared_ptr<Shader> shader);
-        void SetTexture(TextureType type, std::shared_ptr<Texture> texture);
+        void SetShader(Ref<Shader> shader);
+        void SetTexture(TextureType type, Ref<Texture> texture);
         void RemoveTexture(TextureType type);
 
         void SetAlbedo(const Vector3& color) { m_Properties.Albedo = color; }
@@ -40,21 +42,21 @@ namespace YUGA {
         void Unbind();
         void ApplyProperties();
 
-        std::shared_ptr<Shader> GetShader() const { return m_Shader; }
+        Ref<Shader> GetShader() const { return m_Shader; }
         const MaterialProperties& GetProperties() const { return m_Properties; }
         const std::string& GetName() const { return m_Name; }
 
         bool HasTexture(TextureType type) const;
-        std::shared_ptr<Texture> GetTexture(TextureType type) const;
+        Ref<Texture> GetTexture(TextureType type) const;
 
     private:
         std::string m_Name;
-        std::shared_ptr<Shader> m_Shader;
+        Ref<Shader> m_Shader;
         MaterialProperties m_Properties;
-        std::vector<std::pair<TextureType, std::shared_ptr<Texture>>> m_Textures;
+        std::vector<std::pair<TextureType, Ref<Texture>>> m_Textures;
 
         int GetTextureSlot(TextureType type) const;
-        const char* GetTextureUniformName(TextureType type) const;
+        Name GetTextureUniformName(TextureType type) const;
     };
 
 } // namespace YUGA
@@ -17,8 +17,10 @@ namespace YUGA {
         Vertex() : Position(), Normal(), TexCoords{0.0f, 0.0f}, Tangent(), Bitangent() {}
     };
 
-    class Mesh {
+    class Mesh : public RefCounted {
     public:
+        static constexpr MemoryTag PoolTag = MemoryTag::Assets;
+
         std::vector<Vertex> Vertices;
         std::vector<unsigned int> Indices;
         unsigned int MaterialIndex = 0;
@@ -15,8 +15,10 @@ struct aiMaterial;
 
 namespace YUGA {
 
-    class Model {
+    class Model : public RefCounted {
     public:
+        static constexpr MemoryTag PoolTag = MemoryTag::Assets;
+
         Model();
         ~Model();
 
@@ -25,21 +27,21 @@ namespace YUGA {
         void Cleanup();
 
         const std::string& GetPath() const { return m_Path; }
-        const std::vector<std::shared_ptr<Mesh>>& GetMeshes() const { return m_Meshes; }
-        const std::vector<std::shared_ptr<Material>>& GetMaterials() const { return m_Materials; }
+        const std::vector<Ref<Mesh>>& GetMeshes() const { return m_Meshes; }
+        const std::vector<Ref<Material>>& GetMaterials() const { return m_Materials; }
 
-        void SetMaterial(size_t meshIndex, std::shared_ptr<Material> material);
+        void SetMaterial(size_t meshIndex, Ref<Material> material);
 
     private:
         std::string m_Path;
         std::string m_Directory;
-        std::vector<std::shared_ptr<Mesh>> m_Meshes;
-        std::vector<std::shared_ptr<Material>> m_Materials;
+        std::vector<Ref<Mesh>> m_Meshes;
+        std::vector<Ref<Material>> m_Materials;
         bool m_IsLoaded = false;
 
         void ProcessNode(aiNode* node, const aiScene* scene);
-        std::shared_ptr<Mesh> ProcessMesh(aiMesh* mesh, const aiScene* scene);
-        void LoadMaterialTextures(aiMaterial* mat, const aiScene* scene, std::shared_ptr<Material> material);
+        Ref<Mesh> ProcessMesh(aiMesh* mesh, const aiScene* scene);
+        void LoadMaterialTextures(aiMaterial* mat, const aiScene* scene, Ref<Material> material);
     };
 
 } // namespace YUGA
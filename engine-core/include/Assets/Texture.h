@@ -33,8 +33,10 @@ namespace YUGA {
         LinearMipmapLinear
     };
 
-    class Texture {
+    class Texture : public RefCounted {
     public:
+        static constexpr MemoryTag PoolTag = MemoryTag::Assets;
+
         Texture();
         ~Texture();
 
@@ -30,6 +30,7 @@
 
 // Smart pointers
 #include <memory>
+#include "Core/RefCounted.h"
 namespace YUGA {
     template<typename T>
     using Scope = std::unique_ptr<T>;
@@ -39,12 +40,13 @@ namespace YUGA {
         return std::make_unique<T>(std::forward<Args>(args)...);
     }
     
+    // Intrusive, pooled reference; T must derive from RefCounted or RefCountedST
     template<typename T>
-    using Ref = std::shared_ptr<T>;
+    using Ref = IntrusiveRef<T>;
     
     template<typename T, typename... Args>
-    constexpr Ref<T> CreateRef(Args&&... args) {
-        return std::make_shared<T>(std::forward<Args>(args)...);
+    Ref<T> CreateRef(Args&&... args) {
+        return MakePooledRef<T>(std::forward<Args>(args)...);
     }
 }
 
@@ -1,8 +1,10 @@
 #pragma once
 
 #include "Core/Core.h"
+#include "Core/StartupGraph.h"
 #include <string>
 #include <memory>
+#include <vector>
 
 namespace YUGA {
 
@@ -20,6 +22,17 @@ struct EngineConfig {
     uint32_t height = 1080;
     bool fullscreen = false;
     bool vsync = true;
+    
+    // Startup
+    uint32_t workerThreads = 0;              // 0 = hardware threads - 1
+    std::vector<Name> lazySubsystems;        // e.g. "Audio", "Scripting"
+    std::vector<std::string> preloadModels;
+    std::string startupTracePath;            // Chrome trace JSON, written after the first frame
+    
+    // Physics
+    bool asyncPhysics = false;               // Step on a dedicated thread, one frame behind
+    bool multithreadedPhysics = false;       // Bullet's multithreaded world on the job system workers
+    bool deterministicPhysics = false;       // Lockstep: fixed steps, entity-ordered bodies, per-step state hash
 };
 
 class Engine {
@@ -36,6 +49,10 @@ public:
     float GetDeltaTime() const { return m_DeltaTime; }
     float GetFPS() const { return m_FPS; }
     
+    // Initializes a lazy subsystem on first use
+    void RequireSubsystem(Name name) { m_Startup.EnsureInitialized(name); }
+    PhysicsWorld* GetPhysics();
+    
 private:
     Engine() = default;
     ~Engine() = default;
@@ -45,11 +62,17 @@ private:
     
     void Update(float deltaTime);
     void Render();
+    void RegisterSubsystems(const EngineConfig& config);
+    void OnFirstFrame();
     
 private:
     bool m_Running = false;
     float m_DeltaTime = 0.0f;
     float m_FPS = 0.0f;
+    bool m_FirstFrameDone = false;
+    std::string m_StartupTracePath;
+    
+    StartupGraph m_Startup;
     
     Scope<Window> m_Window;
     Scope<Renderer> m_Renderer;
@@ -0,0 +1,152 @@
+#pragma once
+
+#include "Memory/FrameAllocator.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace YUGA {
+
+using EventSubscriptionId = uint32_t;
+
+/**
+ * @brief Engine-wide typed event bus.
+ *
+ * Publish() is lock-free and may be called from any thread: the event is
+ * constructed in the calling thread's frame arena and pushed onto that
+ * thread's MPSC queue. Dispatch() runs on the main thread at the engine's
+ * sync points and delivers every queued event in batches, in publish order
+ * per thread.
+ *
+ * Payloads live in the frame arena, so an event must be dispatched in the
+ * frame it was published in: jobs that publish have to finish before the
+ * frame's last sync point. Handlers receive a const reference that is only
+ * valid for the duration of the call. Events still queued after
+ * MaxDispatchPasses, such as handlers that keep publishing each other, are
+ * dropped with a warning rather than left to outlive their frame.
+ *
+ * Queuing needs something to pump the bus: the engine loop declares it
+ * runs with SetDispatchLoopRunning() and calls Dispatch() and
+ * FrameArena::NextFrame() every frame. Without a loop (tools, managers
+ * used standalone) Publish() delivers to the subscribers at once, on the
+ * calling thread, so nothing piles up unpumped. A publisher whose frame
+ * arena is exhausted gets a heap node, freed once dispatched.
+ *
+ * Subscribe()/Unsubscribe() belong to the main thread. Subscribing from a
+ * handler takes effect after the current Dispatch(); unsubscribing from a
+ * handler takes effect immediately.
+ */
+class EventBus {
+public:
+    // Dispatch passes per sync point; events published by handlers are
+    // delivered in the next pass
+    static constexpr int MaxDispatchPasses = 8;
+
+    template<typename T, typename... Args>
+    static void Publish(Args&&... args) {
+        if (!s_DispatchLoopRunning.load(std::memory_order_acquire)) {
+            T payload{ std::forward<Args>(args)... };
+            DeliverNow(GetTypeId<T>(), &payload);
+            return;
+        }
+        
+        using Node = TypedNode<T>;
+        void* memory = FrameArena::Allocate(sizeof(Node), alignof(Node));
+        bool onHeap = !memory;
+        if (onHeap) {
+            memory = ::operator new(sizeof(Node), std::align_val_t(alignof(Node)), std::nothrow);
+            if (!memory) {
+                ReportDroppedEvent();
+                return;
+            }
+        }
+        
+        Node* node = new (memory) Node(std::forward<Args>(args)...);
+        node->header.typeId = GetTypeId<T>();
+        node->header.payload = &node->payload;
+        if (onHeap) {
+            node->header.destroy = [](EventNode* base) {
+                Node* typed = reinterpret_cast<Node*>(base);
+                typed->~Node();
+                ::operator delete(typed, std::align_val_t(alignof(Node)));
+            };
+        } else if constexpr (!std::is_trivially_destructible_v<T>) {
+            node->header.destroy = [](EventNode* base) {
+                reinterpret_cast<Node*>(base)->~Node();
+            };
+        }
+        Enqueue(&node->header);
+    }
+
+    template<typename T>
+    static EventSubscriptionId Subscribe(std::function<void(const T&)> callback) {
+        return AddSubscriber(GetTypeId<T>(), [callback = std::move(callback)](const void* payload) {
+            callback(*static_cast<const T*>(payload));
+        });
+    }
+
+    static void Unsubscribe(EventSubscriptionId id);
+
+    // Sync point: deliver everything published so far (main thread)
+    static void Dispatch();
+
+    // Drop queued events and subscribers
+    static void Clear();
+    
+    // Set by the loop that calls Dispatch() every frame; while false,
+    // Publish() delivers immediately
+    static void SetDispatchLoopRunning(bool running) { s_DispatchLoopRunning.store(running, std::memory_order_release); }
+    static bool IsDispatchLoopRunning() { return s_DispatchLoopRunning.load(std::memory_order_acquire); }
+
+    static size_t GetLastDispatchCount() { return s_LastDispatchCount; }
+
+private:
+    struct EventNode {
+        EventNode* next = nullptr;
+        uint32_t typeId = 0;
+        void* payload = nullptr;
+        void (*destroy)(EventNode*) = nullptr;
+    };
+
+    template<typename T>
+    struct TypedNode {
+        template<typename... Args>
+        explicit TypedNode(Args&&... args) : payload{ std::forward<Args>(args)... } {}
+
+        EventNode header;
+        T payload;
+    };
+
+    using Handler = std::function<void(const void*)>;
+
+    template<typename T>
+    static uint32_t GetTypeId() {
+        static const uint32_t id = s_NextTypeId.fetch_add(1, std::memory_order_relaxed);
+        return id;
+    }
+
+    struct ThreadQueue;
+
+    static ThreadQueue& GetThreadQueue();
+    static std::vector<ThreadQueue*>& GetQueues();
+    static void Enqueue(EventNode* node);
+    static EventSubscriptionId AddSubscriber(uint32_t typeId, Handler handler);
+    static void Deliver(uint32_t typeId, const void* payload);
+    static void DeliverNow(uint32_t typeId, const void* payload);
+    static void ReportDroppedEvent();
+    static EventNode* CollectQueuedEvents();
+    static size_t DestroyEvents(EventNode* node);
+    static void ApplyPendingSubscriptions();
+
+private:
+    static inline std::atomic<uint32_t> s_NextTypeId{ 0 };
+    static inline size_t s_LastDispatchCount = 0;
+    static inline std::atomic<bool> s_DispatchLoopRunning{ false };
+};
+
+} // namespace YUGA
@@ -0,0 +1,192 @@
+#pragma once
+
+#include "Core/Core.h"
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace YUGA {
+
+/**
+ * @brief 32-bit generational handle: 20-bit slot index + 12-bit generation.
+ *
+ * Handles are trivially copyable and safe to store in components. A handle
+ * whose slot has been freed (and possibly reused) no longer matches the
+ * slot's generation and resolves to null. The value 0 is never issued.
+ */
+template<typename T>
+struct Handle {
+    static constexpr uint32_t IndexBits = 20;
+    static constexpr uint32_t GenerationBits = 12;
+    static constexpr uint32_t IndexMask = (1u << IndexBits) - 1;
+    static constexpr uint32_t GenerationMask = (1u << GenerationBits) - 1;
+    static constexpr uint32_t MaxSlots = 1u << IndexBits;
+
+    uint32_t Value = 0;
+
+    Handle() = default;
+    Handle(uint32_t index, uint32_t generation)
+        : Value((generation & GenerationMask) << IndexBits | (index & IndexMask)) {}
+
+    uint32_t GetIndex() const { return Value & IndexMask; }
+    uint32_t GetGeneration() const { return Value >> IndexBits; }
+    bool IsValid() const { return Value != 0; }
+
+    explicit operator bool() const { return IsValid(); }
+    bool operator==(const Handle& other) const { return Value == other.Value; }
+    bool operator!=(const Handle& other) const { return Value != other.Value; }
+};
+
+/**
+ * @brief Slot indices and generations behind Handle<T>, without the items.
+ *
+ * For owners that keep slot data in arrays of their own, indexed by
+ * Handle::GetIndex(). Freed slots are recycled through a free list with a
+ * bumped generation.
+ */
+template<typename T>
+class HandleAllocator {
+public:
+    // The null handle once every slot is taken
+    Handle<T> Allocate() {
+        uint32_t index;
+        if (!m_FreeIndices.empty()) {
+            index = m_FreeIndices.back();
+            m_FreeIndices.pop_back();
+        } else {
+            if (m_Generations.size() >= Handle<T>::MaxSlots) {
+                return {};
+            }
+            index = static_cast<uint32_t>(m_Generations.size());
+            m_Generations.push_back(1);
+        }
+
+        ++m_Count;
+        return Handle<T>(index, m_Generations[index]);
+    }
+
+    bool Free(Handle<T> handle) {
+        if (!Contains(handle)) {
+            return false;
+        }
+
+        uint32_t index = handle.GetIndex();
+        m_Generations[index] = NextGeneration(m_Generations[index]);
+        m_FreeIndices.push_back(index);
+        --m_Count;
+        return true;
+    }
+
+    bool Contains(Handle<T> handle) const {
+        uint32_t index = handle.GetIndex();
+        return handle.IsValid() && index < m_Generations.size() && m_Generations[index] == handle.GetGeneration();
+    }
+
+    // The handle a slot answers to now; index must be below GetSlotCount()
+    Handle<T> GetHandle(uint32_t index) const { return Handle<T>(index, m_Generations[index]); }
+    uint32_t GetGeneration(uint32_t index) const { return m_Generations[index]; }
+
+    // Slots handed out so far, live or free
+    uint32_t GetSlotCount() const { return static_cast<uint32_t>(m_Generations.size()); }
+    size_t GetCount() const { return m_Count; }
+
+    // Frees every slot; no handle issued so far resolves afterwards
+    void Clear() {
+        m_FreeIndices.clear();
+        for (uint32_t i = GetSlotCount(); i-- > 0;) {
+            m_Generations[i] = NextGeneration(m_Generations[i]);
+            m_FreeIndices.push_back(i);
+        }
+        m_Count = 0;
+    }
+
+private:
+    // Skip generation 0 on wrap so a recycled slot never yields the null handle
+    static uint32_t NextGeneration(uint32_t generation) {
+        generation = (generation + 1) & Handle<T>::GenerationMask;
+        return generation == 0 ? 1 : generation;
+    }
+
+    std::vector<uint32_t> m_Generations;
+    std::vector<uint32_t> m_FreeIndices;
+    size_t m_Count = 0;
+};
+
+/**
+ * @brief Dense slot array addressed by Handle<T>.
+ *
+ * Resolve() is a bounds check, a generation compare and an array index.
+ * Slots come from a HandleAllocator.
+ */
+template<typename T>
+class HandlePool {
+public:
+    Handle<T> Add(Ref<T> item) {
+        Handle<T> handle = m_Slots.Allocate();
+        if (!handle) {
+            return {};
+        }
+
+        uint32_t index = handle.GetIndex();
+        if (index >= m_Items.size()) {
+            m_Items.resize(index + 1);
+        }
+        m_Items[index] = std::move(item);
+        return handle;
+    }
+
+    bool Remove(Handle<T> handle) {
+        if (!m_Slots.Free(handle)) {
+            return false;
+        }
+
+        m_Items[handle.GetIndex()].reset();
+        return true;
+    }
+
+    bool Contains(Handle<T> handle) const {
+        return m_Slots.Contains(handle);
+    }
+
+    T* Resolve(Handle<T> handle) const {
+        return Contains(handle) ? m_Items[handle.GetIndex()].get() : nullptr;
+    }
+
+    const Ref<T>& GetRef(Handle<T> handle) const {
+        static const Ref<T> s_Null;
+        return Contains(handle) ? m_Items[handle.GetIndex()] : s_Null;
+    }
+
+    // Visits every live item; the callback may not add or remove items
+    void ForEach(const std::function<void(Handle<T>, const Ref<T>&)>& callback) const {
+        for (uint32_t i = 0; i < m_Items.size(); ++i) {
+            if (m_Items[i]) {
+                callback(m_Slots.GetHandle(i), m_Items[i]);
+            }
+        }
+    }
+
+    void Clear() {
+        m_Items.clear();
+        m_Slots.Clear();
+    }
+
+    size_t GetCount() const { return m_Slots.GetCount(); }
+
+private:
+    std::vector<Ref<T>> m_Items;
+    HandleAllocator<T> m_Slots;
+};
+
+} // namespace YUGA
+
+namespace std {
+
+template<typename T>
+struct hash<YUGA::Handle<T>> {
+    size_t operator()(const YUGA::Handle<T>& handle) const noexcept {
+        return hash<uint32_t>()(handle.Value);
+    }
+};
+
+} // namespace std
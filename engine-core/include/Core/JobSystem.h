@@ -0,0 +1,52 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+namespace YUGA {
+
+/**
+ * @brief Completion counter for a group of jobs.
+ *
+ * Incremented when a job is scheduled against it and decremented when the
+ * job finishes; JobSystem::Wait() blocks until it reaches zero.
+ */
+struct JobCounter {
+    std::atomic<uint32_t> pending{ 0 };
+
+    bool IsDone() const { return pending.load(std::memory_order_acquire) == 0; }
+};
+
+/**
+ * @brief Fixed pool of worker threads fed from a shared job queue.
+ *
+ * Threads that wait on a counter run queued jobs instead of sleeping, so
+ * waiting from inside a job cannot deadlock the pool. When the system is not
+ * initialized (tools, headless tests) jobs run inline on the caller.
+ */
+class JobSystem {
+public:
+    // workerCount 0 = one worker per hardware thread, minus the main thread
+    static void Initialize(uint32_t workerCount = 0);
+    static void Shutdown();
+
+    static bool IsInitialized();
+    static uint32_t GetWorkerCount();
+
+    // 0 for threads outside the pool (main thread), 1..N for workers
+    static uint32_t GetThreadIndex();
+
+    static void Schedule(std::function<void()> job, JobCounter* counter = nullptr);
+    static void Wait(JobCounter& counter);
+
+    // Runs one queued job on the calling thread; false if the queue was empty
+    static bool RunPendingJob();
+
+    // Splits [0, count) into batches of batchSize and runs them across the
+    // pool, including the calling thread. Returns when every batch is done.
+    static void ParallelFor(size_t count, size_t batchSize, const std::function<void(size_t begin, size_t end)>& body);
+};
+
+} // namespace YUGA
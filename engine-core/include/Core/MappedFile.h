@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace YUGA {
+
+/**
+ * @brief Read-only memory mapping of a whole file.
+ *
+ * CopyOnWrite maps the file privately: pages are shared with the OS file
+ * cache until written, and writes never reach the file. The mapping is
+ * page aligned.
+ */
+class MappedFile {
+public:
+    enum class Access {
+        ReadOnly,
+        CopyOnWrite
+    };
+
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool Open(const std::string& path, Access access = Access::ReadOnly);
+    void Close();
+
+    bool IsOpen() const { return m_Data != nullptr; }
+    void* GetData() const { return m_Data; }
+    size_t GetSize() const { return m_Size; }
+
+private:
+    void* m_Data = nullptr;
+    size_t m_Size = 0;
+#ifdef YUGA_WINDOWS
+    void* m_Mapping = nullptr;
+#endif
+};
+
+} // namespace YUGA
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+namespace YUGA {
+
+// 64-bit FNV-1a, usable in constant expressions
+constexpr uint64_t HashName(std::string_view str) {
+    uint64_t hash = 0xcbf29ce484222325ull;
+    for (char c : str) {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 0x100000001b3ull;
+    }
+    return hash;
+}
+
+/**
+ * @brief Interned identifier: a 64-bit hash of a string.
+ *
+ * Comparing, copying and hashing a Name are integer operations. The source
+ * string is stored once in a global table so it can be recovered for
+ * debug output and for APIs that still need text (e.g. GL uniform lookup).
+ *
+ * Constructing from a string hashes and interns at runtime; hot code should
+ * keep Names around or use YUGA_NAME("literal"), which hashes at compile
+ * time and interns once per call site.
+ */
+class Name {
+public:
+    constexpr Name() = default;
+    Name(std::string_view str);
+    Name(const std::string& str) : Name(std::string_view(str)) {}
+    Name(const char* str) : Name(std::string_view(str)) {}
+
+    static constexpr Name FromHash(uint64_t hash) {
+        Name name;
+        name.m_Hash = hash;
+        return name;
+    }
+
+    constexpr uint64_t GetHash() const { return m_Hash; }
+    constexpr uint32_t GetHash32() const { return static_cast<uint32_t>(m_Hash ^ (m_Hash >> 32)); }
+    constexpr bool IsNone() const { return m_Hash == 0; }
+
+    // Reverse lookup; empty if the name was never interned
+    std::string_view GetString() const;
+    std::string ToString() const;
+
+    constexpr bool operator==(const Name& other) const { return m_Hash == other.m_Hash; }
+    constexpr bool operator!=(const Name& other) const { return m_Hash != other.m_Hash; }
+    constexpr bool operator<(const Name& other) const { return m_Hash < other.m_Hash; }
+
+    // Registers str under a precomputed hash (used by YUGA_NAME)
+    static void Intern(uint64_t hash, std::string_view str);
+    static size_t GetInternedCount();
+
+    // Hash of a literal computed at compile time, interned on first use
+    template<uint64_t Hash>
+    static Name Literal(std::string_view str) {
+        static const bool interned = (Intern(Hash, str), true);
+        (void)interned;
+        return FromHash(Hash);
+    }
+
+private:
+    uint64_t m_Hash = 0;
+};
+
+inline std::ostream& operator<<(std::ostream& out, const Name& name) {
+    return out << name.ToString();
+}
+
+} // namespace YUGA
+
+#define YUGA_NAME(literal) ::YUGA::Name::Literal<::YUGA::HashName(literal)>(literal)
+
+namespace std {
+
+template<>
+struct hash<YUGA::Name> {
+    size_t operator()(const YUGA::Name& name) const noexcept {
+        return static_cast<size_t>(name.GetHash());
+    }
+};
+
+} // namespace std
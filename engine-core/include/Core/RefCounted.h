@@ -0,0 +1,213 @@
+#pragma once
+
+#include "Memory/ObjectPool.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+namespace YUGA {
+
+template<typename T> class IntrusiveRef;
+
+enum class RefCountPolicy {
+    Atomic,     // Shared across threads
+    NonAtomic   // Owned and released by a single thread
+};
+
+/**
+ * @brief Intrusive reference count embedded in the object itself.
+ *
+ * Removes the separate control block of std::shared_ptr. Objects should be
+ * created with CreateRef so they are placed in their type's pool and know
+ * how to release their storage.
+ */
+template<RefCountPolicy Policy>
+class RefCountedBase {
+public:
+    void AddRef() const {
+        if constexpr (Policy == RefCountPolicy::Atomic) {
+            m_RefCount.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            ++m_RefCount;
+        }
+    }
+
+    void Release() const {
+        bool last;
+        if constexpr (Policy == RefCountPolicy::Atomic) {
+            last = m_RefCount.fetch_sub(1, std::memory_order_acq_rel) == 1;
+        } else {
+            last = --m_RefCount == 0;
+        }
+
+        if (last) {
+            m_Deleter(const_cast<RefCountedBase*>(this));
+        }
+    }
+
+    uint32_t GetRefCount() const {
+        if constexpr (Policy == RefCountPolicy::Atomic) {
+            return m_RefCount.load(std::memory_order_relaxed);
+        } else {
+            return m_RefCount;
+        }
+    }
+
+protected:
+    RefCountedBase() = default;
+    ~RefCountedBase() = default;
+
+    // Copies start with a fresh count; the new object gets its own deleter
+    RefCountedBase(const RefCountedBase&) {}
+    RefCountedBase& operator=(const RefCountedBase&) { return *this; }
+
+private:
+    using Counter = std::conditional_t<Policy == RefCountPolicy::Atomic, std::atomic<uint32_t>, uint32_t>;
+    using Deleter = void (*)(RefCountedBase*);
+
+    mutable Counter m_RefCount{ 0 };
+    Deleter m_Deleter = nullptr;
+
+    template<typename T> friend class IntrusiveRef;
+    template<typename T, typename... Args> friend IntrusiveRef<T> MakePooledRef(Args&&... args);
+};
+
+using RefCounted = RefCountedBase<RefCountPolicy::Atomic>;
+using RefCountedST = RefCountedBase<RefCountPolicy::NonAtomic>;
+
+// Memory tag used for a type's pool: T::PoolTag if declared, otherwise General
+template<typename T>
+constexpr MemoryTag GetPoolTag() {
+    if constexpr (requires { T::PoolTag; }) {
+        return T::PoolTag;
+    } else {
+        return MemoryTag::General;
+    }
+}
+
+template<typename T>
+ObjectPool<T>& GetObjectPool() {
+    // Intentionally leaked so refs held by other statics stay valid at exit
+    static ObjectPool<T>* pool = new ObjectPool<T>(GetPoolTag<T>());
+    return *pool;
+}
+
+/**
+ * @brief Smart pointer for RefCountedBase-derived types.
+ *
+ * Mirrors the subset of the std::shared_ptr interface the engine uses so it
+ * can stand in for it behind Ref<T>.
+ */
+template<typename T>
+class IntrusiveRef {
+public:
+    using element_type = T;
+
+    IntrusiveRef() = default;
+    IntrusiveRef(std::nullptr_t) {}
+
+    // Takes a reference to ptr; objects not created through CreateRef are
+    // assumed to come from new and are deleted with delete
+    explicit IntrusiveRef(T* ptr) : m_Ptr(ptr) {
+        if (m_Ptr) {
+            if (!m_Ptr->m_Deleter) {
+                m_Ptr->m_Deleter = [](auto* base) { delete static_cast<T*>(base); };
+            }
+            m_Ptr->AddRef();
+        }
+    }
+
+    IntrusiveRef(const IntrusiveRef& other) : m_Ptr(other.m_Ptr) {
+        if (m_Ptr) m_Ptr->AddRef();
+    }
+
+    IntrusiveRef(IntrusiveRef&& other) noexcept : m_Ptr(other.m_Ptr) {
+        other.m_Ptr = nullptr;
+    }
+
+    template<typename U, typename = std::enable_if_t<std::is_convertible_v<U*, T*>>>
+    IntrusiveRef(const IntrusiveRef<U>& other) : m_Ptr(other.get()) {
+        if (m_Ptr) m_Ptr->AddRef();
+    }
+
+    template<typename U, typename = std::enable_if_t<std::is_convertible_v<U*, T*>>>
+    IntrusiveRef(IntrusiveRef<U>&& other) noexcept : m_Ptr(other.Detach()) {}
+
+    ~IntrusiveRef() {
+        if (m_Ptr) m_Ptr->Release();
+    }
+
+    IntrusiveRef& operator=(IntrusiveRef other) noexcept {
+        std::swap(m_Ptr, other.m_Ptr);
+        return *this;
+    }
+
+    void reset() {
+        IntrusiveRef().swap(*this);
+    }
+
+    void swap(IntrusiveRef& other) noexcept {
+        std::swap(m_Ptr, other.m_Ptr);
+    }
+
+    T* get() const { return m_Ptr; }
+    T* operator->() const { return m_Ptr; }
+    T& operator*() const { return *m_Ptr; }
+    explicit operator bool() const { return m_Ptr != nullptr; }
+
+    uint32_t use_count() const { return m_Ptr ? m_Ptr->GetRefCount() : 0; }
+
+    // Releases ownership without decrementing the count
+    T* Detach() {
+        T* ptr = m_Ptr;
+        m_Ptr = nullptr;
+        return ptr;
+    }
+
+    template<typename U>
+    bool operator==(const IntrusiveRef<U>& other) const { return m_Ptr == other.get(); }
+    bool operator==(std::nullptr_t) const { return m_Ptr == nullptr; }
+
+private:
+    T* m_Ptr = nullptr;
+};
+
+// Constructs T in its type's pool
+template<typename T, typename... Args>
+IntrusiveRef<T> MakePooledRef(Args&&... args) {
+    ObjectPool<T>& pool = GetObjectPool<T>();
+    void* memory = pool.Allocate();
+    if (!memory) {
+        return nullptr;
+    }
+
+    T* object = new (memory) T(std::forward<Args>(args)...);
+    object->m_Deleter = [](auto* base) {
+        T* typed = static_cast<T*>(base);
+        typed->~T();
+        GetObjectPool<T>().Free(typed);
+    };
+
+    return IntrusiveRef<T>(object);
+}
+
+template<typename T, typename U>
+IntrusiveRef<T> StaticRefCast(const IntrusiveRef<U>& ref) {
+    return IntrusiveRef<T>(static_cast<T*>(ref.get()));
+}
+
+} // namespace YUGA
+
+namespace std {
+
+template<typename T>
+struct hash<YUGA::IntrusiveRef<T>> {
+    size_t operator()(const YUGA::IntrusiveRef<T>& ref) const noexcept {
+        return hash<T*>()(ref.get());
+    }
+};
+
+} // namespace std
@@ -0,0 +1,99 @@
+#pragma once
+
+#include "Core/Name.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <unordered_map>
+#include <vector>
+
+namespace YUGA {
+
+struct SubsystemDesc {
+    Name name;
+    std::vector<Name> dependencies;
+    std::function<void()> initialize;
+    std::function<void()> shutdown;
+    bool mainThread = false;  // Needs the main thread (e.g. owns the GL context)
+    bool lazy = false;        // Skipped at startup, initialized on first EnsureInitialized()
+};
+
+struct SubsystemTrace {
+    Name name;
+    double startMs = 0.0;     // Relative to StartupGraph::Run()
+    double durationMs = 0.0;
+    uint32_t threadIndex = 0; // JobSystem thread index, 0 = main thread
+    bool lazy = false;
+};
+
+/**
+ * @brief Initializes engine subsystems in dependency order.
+ *
+ * Each subsystem declares its prerequisites. Run() starts every subsystem
+ * whose dependencies are satisfied at once: worker-safe ones as jobs, the
+ * rest on the calling (main) thread. Lazy subsystems are left alone unless
+ * an eager one depends on them. Every initialization is timed for the
+ * startup trace.
+ */
+class StartupGraph {
+public:
+    StartupGraph() = default;
+    StartupGraph(const StartupGraph&) = delete;
+    StartupGraph& operator=(const StartupGraph&) = delete;
+
+    void Register(SubsystemDesc desc);
+
+    // Returns false (and initializes nothing) on unknown dependencies or cycles
+    bool Run();
+
+    // Initializes a subsystem and its dependencies if that has not happened yet
+    void EnsureInitialized(Name name);
+    bool IsInitialized(Name name) const;
+
+    // Shuts subsystems down in reverse initialization order
+    void Shutdown();
+
+    // Milliseconds since Run() started
+    double GetElapsedMs() const;
+
+    std::vector<SubsystemTrace> GetTrace() const;
+    void LogTrace(double firstFrameMs) const;
+    // Chrome trace event format (chrome://tracing, Perfetto)
+    void WriteTrace(std::ostream& out, double firstFrameMs) const;
+
+private:
+    struct Node {
+        SubsystemDesc desc;
+        std::vector<size_t> dependencyIndices;
+        std::vector<size_t> dependents;
+        int pendingDependencies = 0;
+        std::once_flag once;
+        std::atomic<bool> initialized{ false };
+    };
+
+    void Launch(size_t index);
+    void Initialize(size_t index, bool lazy);
+    void OnInitialized(size_t index);
+
+private:
+    std::vector<std::unique_ptr<Node>> m_Nodes;
+    std::unordered_map<Name, size_t> m_Lookup;
+
+    mutable std::mutex m_Mutex;
+    std::condition_variable m_Condition;
+    std::deque<size_t> m_MainThreadQueue;
+    std::vector<bool> m_Eager;
+    size_t m_Remaining = 0;
+
+    std::vector<size_t> m_InitOrder;
+    std::vector<SubsystemTrace> m_Trace;
+    std::chrono::steady_clock::time_point m_StartTime = std::chrono::steady_clock::now();
+};
+
+} // namespace YUGA
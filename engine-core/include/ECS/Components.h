@@ -1,11 +1,16 @@
 #pragma once
 
 #include "Core/Core.h"
+#include "Core/Handle.h"
 #include "Math/Vector3.h"
 #include <string>
 
 namespace YUGA {
     
+    class Model;
+    class Material;
+    class RigidBody;
+    
     struct TagComponent {
         std::string Tag;
         
@@ -26,8 +31,9 @@ namespace YUGA {
     };
     
     struct MeshComponent {
-        uint32_t MeshId = 0;
-        uint32_t MaterialId = 0;
+        // Generational handles into AssetManager; stale handles resolve to null
+        Handle<Model> MeshId;
+        Handle<Material> MaterialId;
         
         MeshComponent() = default;
         MeshComponent(const MeshComponent&) = default;
@@ -55,6 +61,7 @@ namespace YUGA {
         float Mass = 1.0f;
         bool IsKinematic = false;
         Vector3 Velocity{ 0.0f, 0.0f, 0.0f };
+        RigidBody* Body = nullptr;   // Runtime body, not owned
         
         RigidBodyComponent() = default;
         RigidBodyComponent(const RigidBodyComponent&) = default;
@@ -95,12 +102,13 @@ namespace YUGA {
     };
     
     struct ColliderComponent {
-        enum class Shape { Box, Sphere, Capsule, Mesh };
+        // Mesh: static triangle mesh; ConvexMesh: convex decomposition, may be dynamic
+        enum class Shape { Box, Sphere, Capsule, Mesh, ConvexMesh };
         
         Shape ColliderShape = Shape::Box;
         Vector3 Size{ 1.0f, 1.0f, 1.0f };
         Vector3 Center{ 0.0f, 0.0f, 0.0f };
-        bool IsTrigger = false;
+        bool IsTrigger = false;      // Box/Sphere without a RigidBodyComponent: TriggerSystem volume
         
         ColliderComponent() = default;
         ColliderComponent(const ColliderComponent&) = default;
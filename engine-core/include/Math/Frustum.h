@@ -0,0 +1,27 @@
+#pragma once
+#include "Math/Matrix4.h"
+#include "Math/Vector3.h"
+#include "Math/Vector4.h"
+
+namespace YUGA {
+
+/**
+ * @brief Six inward-facing planes of a view volume.
+ *
+ * Each plane is (normal, distance) with normal . p + distance >= 0 on the
+ * inside. Built from an OpenGL-style view-projection matrix (clip z in
+ * [-w, w]), like the ones Camera produces.
+ */
+struct Frustum {
+    enum Plane { Left, Right, Bottom, Top, Near, Far, PlaneCount };
+    
+    Vector4 planes[PlaneCount];
+    
+    static Frustum FromMatrix(const Matrix4& viewProjection);
+    
+    // Conservative: boxes near a corner may pass while just outside
+    bool IntersectsBox(const Vector3& min, const Vector3& max) const;
+    bool IntersectsSphere(const Vector3& center, float radius) const;
+};
+
+} // namespace YUGA
@@ -0,0 +1,50 @@
+#pragma once
+#include "Math/SIMD.h"
+#include <cstdint>
+
+namespace YUGA {
+
+/**
+ * @brief Seeded xoshiro128+ generator for per-object random streams.
+ *
+ * Eight generators run side by side in SIMD registers, so Fill() makes
+ * eight floats per step; Next() hands out one value of such a block at a
+ * time. The same seed and the same calls always give the same sequence.
+ * Not thread-safe: give each thread or object its own Random.
+ */
+class Random {
+public:
+    static constexpr uint32_t Lanes = 8;
+    
+    explicit Random(uint64_t seed = 0) { Seed(seed); }
+    
+    void Seed(uint64_t seed);
+    
+    // Uniform in [0, 1)
+    float Next() {
+        if (bufferedIndex == Lanes) {
+            NextFloat8().StoreUnaligned(buffered);
+            bufferedIndex = 0;
+        }
+        return buffered[bufferedIndex++];
+    }
+    
+    float Range(float min, float max) { return min + Next() * (max - min); }
+    
+    // Writes count values uniform in [min, max)
+    void Fill(float* out, uint32_t count, float min, float max);
+    
+private:
+    Float8 NextFloat8();
+    
+    // Lane i's state is s0[i], s1[i], s2[i], s3[i]
+    uint32_t s0[Lanes];
+    uint32_t s1[Lanes];
+    uint32_t s2[Lanes];
+    uint32_t s3[Lanes];
+    
+    float buffered[Lanes];
+    uint32_t bufferedIndex = Lanes;
+};
+
+} // namespace YUGA
@@ -0,0 +1,221 @@
+#pragma once
+#include <bit>
+#include <cstdint>
+
+// Backend: one AVX2 register, two SSE registers, or plain arrays.
+// SSE2 is the x64 baseline; AVX2 needs -mavx2 (YUGA_ENABLE_AVX2 in CMake).
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define YUGA_SIMD_AVX 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define YUGA_SIMD_SSE 1
+#endif
+
+namespace YUGA {
+
+/**
+ * @brief Eight floats processed together.
+ *
+ * Load() and Store() expect 32-byte aligned pointers. Comparisons return
+ * a mask with every bit of a lane set or cleared, for Select() and
+ * MoveMask(); bit i of MoveMask() is lane i. The Unaligned variants
+ * take any float pointer.
+ */
+struct Float8 {
+    static constexpr int Width = 8;
+    
+#if defined(YUGA_SIMD_AVX)
+    __m256 v;
+    
+    static Float8 Load(const float* p) { return { _mm256_load_ps(p) }; }
+    static Float8 LoadUnaligned(const float* p) { return { _mm256_loadu_ps(p) }; }
+    static Float8 Broadcast(float value) { return { _mm256_set1_ps(value) }; }
+    void Store(float* p) const { _mm256_store_ps(p, v); }
+    void StoreUnaligned(float* p) const { _mm256_storeu_ps(p, v); }
+    
+    Float8 operator+(const Float8& other) const { return { _mm256_add_ps(v, other.v) }; }
+    Float8 operator-(const Float8& other) const { return { _mm256_sub_ps(v, other.v) }; }
+    Float8 operator*(const Float8& other) const { return { _mm256_mul_ps(v, other.v) }; }
+    Float8 operator/(const Float8& other) const { return { _mm256_div_ps(v, other.v) }; }
+    
+    static Float8 Min(const Float8& a, const Float8& b) { return { _mm256_min_ps(a.v, b.v) }; }
+    static Float8 Max(const Float8& a, const Float8& b) { return { _mm256_max_ps(a.v, b.v) }; }
+    
+    static Float8 GreaterEqual(const Float8& a, const Float8& b) { return { _mm256_cmp_ps(a.v, b.v, _CMP_GE_OQ) }; }
+    static Float8 Select(const Float8& mask, const Float8& a, const Float8& b) { return { _mm256_blendv_ps(b.v, a.v, mask.v) }; }
+    static uint32_t MoveMask(const Float8& mask) { return static_cast<uint32_t>(_mm256_movemask_ps(mask.v)); }
+    
+#elif defined(YUGA_SIMD_SSE)
+    __m128 lo, hi;
+    
+    static Float8 Load(const float* p) { return { _mm_load_ps(p), _mm_load_ps(p + 4) }; }
+    static Float8 LoadUnaligned(const float* p) { return { _mm_loadu_ps(p), _mm_loadu_ps(p + 4) }; }
+    static Float8 Broadcast(float value) { __m128 s = _mm_set1_ps(value); return { s, s }; }
+    void Store(float* p) const { _mm_store_ps(p, lo); _mm_store_ps(p + 4, hi); }
+    void StoreUnaligned(float* p) const { _mm_storeu_ps(p, lo); _mm_storeu_ps(p + 4, hi); }
+    
+    Float8 operator+(const Float8& other) const { return { _mm_add_ps(lo, other.lo), _mm_add_ps(hi, other.hi) }; }
+    Float8 operator-(const Float8& other) const { return { _mm_sub_ps(lo, other.lo), _mm_sub_ps(hi, other.hi) }; }
+    Float8 operator*(const Float8& other) const { return { _mm_mul_ps(lo, other.lo), _mm_mul_ps(hi, other.hi) }; }
+    Float8 operator/(const Float8& other) const { return { _mm_div_ps(lo, other.lo), _mm_div_ps(hi, other.hi) }; }
+    
+    static Float8 Min(const Float8& a, const Float8& b) { return { _mm_min_ps(a.lo, b.lo), _mm_min_ps(a.hi, b.hi) }; }
+    static Float8 Max(const Float8& a, const Float8& b) { return { _mm_max_ps(a.lo, b.lo), _mm_max_ps(a.hi, b.hi) }; }
+    
+    static Float8 GreaterEqual(const Float8& a, const Float8& b) { return { _mm_cmpge_ps(a.lo, b.lo), _mm_cmpge_ps(a.hi, b.hi) }; }
+    
+    // SSE2 has no blend instruction
+    static Float8 Select(const Float8& mask, const Float8& a, const Float8& b) {
+        return { _mm_or_ps(_mm_and_ps(mask.lo, a.lo), _mm_andnot_ps(mask.lo, b.lo)),
+                 _mm_or_ps(_mm_and_ps(mask.hi, a.hi), _mm_andnot_ps(mask.hi, b.hi)) };
+    }
+    
+    static uint32_t MoveMask(const Float8& mask) {
+        return static_cast<uint32_t>(_mm_movemask_ps(mask.lo) | (_mm_movemask_ps(mask.hi) << 4));
+    }
+    
+#else
+    float v[Width];
+    
+    static Float8 Load(const float* p) { Float8 r; for (int i = 0; i < Width; ++i) r.v[i] = p[i]; return r; }
+    static Float8 LoadUnaligned(const float* p) { return Load(p); }
+    static Float8 Broadcast(float value) { Float8 r; for (int i = 0; i < Width; ++i) r.v[i] = value; return r; }
+    void Store(float* p) const { for (int i = 0; i < Width; ++i) p[i] = v[i]; }
+    void StoreUnaligned(float* p) const { Store(p); }
+    
+    Float8 operator+(const Float8& other) const { Float8 r; for (int i = 0; i < Width; ++i) r.v[i] = v[i] + other.v[i]; return r; }
+    Float8 operator-(const Float8& other) const { Float8 r; for (int i = 0; i < Width; ++i) r.v[i] = v[i] - other.v[i]; return r; }
+    Float8 operator*(const Float8& other) const { Float8 r; for (int i = 0; i < Width; ++i) r.v[i] = v[i] * other.v[i]; return r; }
+    Float8 operator/(const Float8& other) const { Float8 r; for (int i = 0; i < Width; ++i) r.v[i] = v[i] / other.v[i]; return r; }
+    
+    // A NaN in either lane gives b's lane, as minps/maxps do
+    static Float8 Min(const Float8& a, const Float8& b) { Float8 r; for (int i = 0; i < Width; ++i) r.v[i] = a.v[i] < b.v[i] ? a.v[i] : b.v[i]; return r; }
+    static Float8 Max(const Float8& a, const Float8& b) { Float8 r; for (int i = 0; i < Width; ++i) r.v[i] = a.v[i] > b.v[i] ? a.v[i] : b.v[i]; return r; }
+    
+    static Float8 GreaterEqual(const Float8& a, const Float8& b) {
+        Float8 r;
+        for (int i = 0; i < Width; ++i) r.v[i] = std::bit_cast<float>(a.v[i] >= b.v[i] ? ~0u : 0u);
+        return r;
+    }
+    
+    static Float8 Select(const Float8& mask, const Float8& a, const Float8& b) {
+        Float8 r;
+        for (int i = 0; i < Width; ++i) r.v[i] = std::bit_cast<uint32_t>(mask.v[i]) ? a.v[i] : b.v[i];
+        return r;
+    }
+    
+    static uint32_t MoveMask(const Float8& mask) {
+        uint32_t bits = 0;
+        for (int i = 0; i < Width; ++i) bits |= (std::bit_cast<uint32_t>(mask.v[i]) >> 31) << i;
+        return bits;
+    }
+#endif
+};
+
+/**
+ * @brief Eight 32-bit unsigned integers processed together.
+ *
+ * Only what integer kernels such as random number generation and table
+ * lookups need: wrapping add, bitwise ops, shifts by a constant and
+ * conversions. Load() and Store() take any pointer.
+ */
+struct UInt32x8 {
+    static constexpr int Width = 8;
+    
+#if defined(YUGA_SIMD_AVX)
+    __m256i v;
+    
+    static UInt32x8 Load(const uint32_t* p) { return { _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)) }; }
+    void Store(uint32_t* p) const { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v); }
+    
+    UInt32x8 operator+(const UInt32x8& other) const { return { _mm256_add_epi32(v, other.v) }; }
+    UInt32x8 operator^(const UInt32x8& other) const { return { _mm256_xor_si256(v, other.v) }; }
+    UInt32x8 operator|(const UInt32x8& other) const { return { _mm256_or_si256(v, other.v) }; }
+    
+    template<int Bits> UInt32x8 ShiftLeft() const { return { _mm256_slli_epi32(v, Bits) }; }
+    template<int Bits> UInt32x8 ShiftRight() const { return { _mm256_srli_epi32(v, Bits) }; }
+    
+    // Lanes must be below 2^31
+    Float8 ToFloat8() const { return { _mm256_cvtepi32_ps(v) }; }
+    
+    // Rounds toward zero; lanes must be in [0, 2^31)
+    static UInt32x8 Truncate(const Float8& f) { return { _mm256_cvttps_epi32(f.v) }; }
+    
+    // table[lane] for every lane
+    Float8 Gather(const float* table) const { return { _mm256_i32gather_ps(table, v, 4) }; }
+    
+#elif defined(YUGA_SIMD_SSE)
+    __m128i lo, hi;
+    
+    static UInt32x8 Load(const uint32_t* p) {
+        return { _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)), _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 4)) };
+    }
+    
+    void Store(uint32_t* p) const {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p), lo);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p + 4), hi);
+    }
+    
+    UInt32x8 operator+(const UInt32x8& other) const { return { _mm_add_epi32(lo, other.lo), _mm_add_epi32(hi, other.hi) }; }
+    UInt32x8 operator^(const UInt32x8& other) const { return { _mm_xor_si128(lo, other.lo), _mm_xor_si128(hi, other.hi) }; }
+    UInt32x8 operator|(const UInt32x8& other) const { return { _mm_or_si128(lo, other.lo), _mm_or_si128(hi, other.hi) }; }
+    
+    template<int Bits> UInt32x8 ShiftLeft() const { return { _mm_slli_epi32(lo, Bits), _mm_slli_epi32(hi, Bits) }; }
+    template<int Bits> UInt32x8 ShiftRight() const { return { _mm_srli_epi32(lo, Bits), _mm_srli_epi32(hi, Bits) }; }
+    
+    // Lanes must be below 2^31
+    Float8 ToFloat8() const { return { _mm_cvtepi32_ps(lo), _mm_cvtepi32_ps(hi) }; }
+    
+    // Rounds toward zero; lanes must be in [0, 2^31)
+    static UInt32x8 Truncate(const Float8& f) { return { _mm_cvttps_epi32(f.lo), _mm_cvttps_epi32(f.hi) }; }
+    
+    // table[lane] for every lane; SSE2 has no gather, so one load per lane
+    Float8 Gather(const float* table) const {
+        alignas(16) uint32_t index[Width];
+        Store(index);
+        return { _mm_setr_ps(table[index[0]], table[index[1]], table[index[2]], table[index[3]]),
+                 _mm_setr_ps(table[index[4]], table[index[5]], table[index[6]], table[index[7]]) };
+    }
+    
+#else
+    uint32_t v[Width];
+    
+    static UInt32x8 Load(const uint32_t* p) { UInt32x8 r; for (int i = 0; i < Width; ++i) r.v[i] = p[i]; return r; }
+    void Store(uint32_t* p) const { for (int i = 0; i < Width; ++i) p[i] = v[i]; }
+    
+    UInt32x8 operator+(const UInt32x8& other) const { UInt32x8 r; for (int i = 0; i < Width; ++i) r.v[i] = v[i] + other.v[i]; return r; }
+    UInt32x8 operator^(const UInt32x8& other) const { UInt32x8 r; for (int i = 0; i < Width; ++i) r.v[i] = v[i] ^ other.v[i]; return r; }
+    UInt32x8 operator|(const UInt32x8& other) const { UInt32x8 r; for (int i = 0; i < Width; ++i) r.v[i] = v[i] | other.v[i]; return r; }
+    
+    template<int Bits> UInt32x8 ShiftLeft() const { UInt32x8 r; for (int i = 0; i < Width; ++i) r.v[i] = v[i] << Bits; return r; }
+    template<int Bits> UInt32x8 ShiftRight() const { UInt32x8 r; for (int i = 0; i < Width; ++i) r.v[i] = v[i] >> Bits; return r; }
+    
+    // Lanes must be below 2^31
+    Float8 ToFloat8() const {
+        Float8 r;
+        for (int i = 0; i < Width; ++i) r.v[i] = static_cast<float>(static_cast<int32_t>(v[i]));
+        return r;
+    }
+    
+    // Rounds toward zero; lanes must be in [0, 2^31). Others, NaN included,
+    // give what cvttps gives rather than undefined behavior.
+    static UInt32x8 Truncate(const Float8& f) {
+        UInt32x8 r;
+        for (int i = 0; i < Width; ++i) {
+            float x = f.v[i];
+            r.v[i] = x >= -2147483648.0f && x < 2147483648.0f ? static_cast<uint32_t>(static_cast<int32_t>(x)) : 0x80000000u;
+        }
+        return r;
+    }
+    
+    // table[lane] for every lane
+    Float8 Gather(const float* table) const {
+        Float8 r;
+        for (int i = 0; i < Width; ++i) r.v[i] = table[v[i]];
+        return r;
+    }
+#endif
+};
+
+} // namespace YUGA
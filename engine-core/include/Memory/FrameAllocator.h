@@ -0,0 +1,122 @@
+#pragma once
+
+#include "Core/Core.h"
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <vector>
+#include <new>
+
+namespace YUGA {
+
+/**
+ * @brief Bump allocator for short-lived data.
+ *
+ * Allocation is a pointer increment; individual frees are no-ops and the
+ * whole arena is released at once with Reset(). If a frame overflows the
+ * primary block, overflow chunks are taken from the heap and the primary
+ * block is grown on the next Reset() so the steady state never mallocs.
+ */
+class LinearArena {
+public:
+    explicit LinearArena(size_t capacity = 0);
+    ~LinearArena();
+
+    LinearArena(const LinearArena&) = delete;
+    LinearArena& operator=(const LinearArena&) = delete;
+
+    void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+    void Reset();
+
+    template<typename T>
+    T* AllocateArray(size_t count) {
+        return static_cast<T*>(Allocate(sizeof(T) * count, alignof(T)));
+    }
+
+    size_t GetCapacity() const { return m_Capacity; }
+    size_t GetUsed() const { return m_Offset + m_OverflowBytes; }
+    size_t GetHighWaterMark() const { return m_HighWaterMark; }
+
+private:
+    void* AllocateOverflow(size_t size, size_t alignment);
+
+    struct OverflowChunk {
+        void* memory;
+        size_t alignment;
+    };
+
+private:
+    uint8_t* m_Buffer = nullptr;
+    size_t m_Capacity = 0;
+    size_t m_Offset = 0;
+
+    std::vector<OverflowChunk> m_OverflowChunks;
+    size_t m_OverflowBytes = 0;
+    size_t m_HighWaterMark = 0;
+};
+
+/**
+ * @brief Per-thread frame arenas.
+ *
+ * Every thread (main and workers) owns its own LinearArena. NextFrame() is
+ * called once per frame by the engine; each thread's arena resets lazily the
+ * first time it allocates in the new frame, so no cross-thread reset is needed.
+ * Memory returned from here is valid until the end of the current frame.
+ */
+class FrameArena {
+public:
+    static constexpr size_t DefaultCapacity = 1024 * 1024;
+
+    static void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+    template<typename T>
+    static T* AllocateArray(size_t count) {
+        return static_cast<T*>(Allocate(sizeof(T) * count, alignof(T)));
+    }
+
+    static void NextFrame();
+    static uint64_t GetFrameIndex() { return s_FrameIndex.load(std::memory_order_acquire); }
+
+    // Arena of the calling thread (reset for the current frame)
+    static LinearArena& GetThreadArena();
+
+private:
+    static std::atomic<uint64_t> s_FrameIndex;
+};
+
+/**
+ * @brief std-compatible allocator backed by the calling thread's frame arena.
+ *
+ * deallocate() is a no-op; containers using it must not outlive the frame.
+ */
+template<typename T>
+class FrameAllocator {
+public:
+    using value_type = T;
+
+    FrameAllocator() noexcept = default;
+
+    template<typename U>
+    FrameAllocator(const FrameAllocator<U>&) noexcept {}
+
+    T* allocate(size_t count) {
+        T* memory = FrameArena::AllocateArray<T>(count);
+        if (!memory) {
+            throw std::bad_alloc();
+        }
+        return memory;
+    }
+
+    void deallocate(T*, size_t) noexcept {}
+
+    template<typename U>
+    bool operator==(const FrameAllocator<U>&) const noexcept { return true; }
+
+    template<typename U>
+    bool operator!=(const FrameAllocator<U>&) const noexcept { return false; }
+};
+
+template<typename T>
+using FrameVector = std::vector<T, FrameAllocator<T>>;
+
+} // namespace YUGA
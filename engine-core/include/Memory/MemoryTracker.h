@@ -0,0 +1,124 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <vector>
+#include <new>
+
+namespace YUGA {
+
+enum class MemoryTag : uint8_t {
+    General,
+    Physics,
+    Assets,
+    Animation,
+    Particles,
+    Scripting,
+    Network,
+    Count
+};
+
+const char* GetMemoryTagName(MemoryTag tag);
+
+enum class MemoryBudgetLevel {
+    Soft,
+    Hard
+};
+
+struct MemoryTagStats {
+    size_t liveBytes = 0;
+    size_t peakBytes = 0;
+    uint64_t allocationCount = 0;
+    uint64_t freeCount = 0;
+    float allocationsPerSecond = 0.0f;
+    size_t softBudget = 0;  // 0 = no budget
+    size_t hardBudget = 0;  // 0 = no budget
+};
+
+/**
+ * @brief Per-subsystem allocation accounting with soft/hard budgets.
+ *
+ * Counters are lock-free atomics so tracking is safe from worker threads.
+ * Crossing a soft budget fires the budget callback once; an allocation that
+ * would cross a hard budget fires the callback and is refused, unless it
+ * comes through AllocateUnrefused.
+ */
+class MemoryTracker {
+public:
+    using BudgetCallback = std::function<void(MemoryTag tag, MemoryBudgetLevel level, size_t liveBytes, size_t budget)>;
+
+    // Tracked heap allocation (size is stored in a small header)
+    static void* Allocate(MemoryTag tag, size_t size);
+    static void Free(MemoryTag tag, void* ptr);
+
+    // For allocators whose callers cannot handle failure (Bullet): crossing
+    // the hard budget fires the callback once but the allocation goes ahead
+    static void* AllocateUnrefused(MemoryTag tag, size_t size);
+
+    // Accounting only, for memory allocated elsewhere (containers, GPU, Lua)
+    static bool RecordAllocation(MemoryTag tag, size_t size);
+    static void RecordFree(MemoryTag tag, size_t size);
+
+    // Budgets
+    static void SetBudget(MemoryTag tag, size_t softBytes, size_t hardBytes);
+    static void SetBudgetCallback(BudgetCallback callback);
+
+    // Call once per frame to refresh allocation rates
+    static void Update(float deltaTime);
+
+    // Reporting
+    static MemoryTagStats GetStats(MemoryTag tag);
+    static size_t GetTotalLiveBytes();
+    static void WriteReport(std::ostream& out);
+    static bool DumpReport(const std::string& filepath);
+
+private:
+    static bool Track(MemoryTag tag, size_t size, bool refuseOverHardBudget);
+    static void NotifyBudget(MemoryTag tag, MemoryBudgetLevel level, size_t liveBytes, size_t budget);
+};
+
+/**
+ * @brief std-compatible allocator that accounts its memory against a tag.
+ */
+template<typename T, MemoryTag Tag>
+class TrackedAllocator {
+public:
+    using value_type = T;
+
+    template<typename U>
+    struct rebind {
+        using other = TrackedAllocator<U, Tag>;
+    };
+
+    TrackedAllocator() noexcept = default;
+
+    template<typename U>
+    TrackedAllocator(const TrackedAllocator<U, Tag>&) noexcept {}
+
+    T* allocate(size_t count) {
+        size_t bytes = sizeof(T) * count;
+        if (!MemoryTracker::RecordAllocation(Tag, bytes)) {
+            throw std::bad_alloc();
+        }
+        return static_cast<T*>(::operator new(bytes, std::align_val_t(alignof(T))));
+    }
+
+    void deallocate(T* ptr, size_t count) noexcept {
+        ::operator delete(ptr, std::align_val_t(alignof(T)));
+        MemoryTracker::RecordFree(Tag, sizeof(T) * count);
+    }
+
+    template<typename U>
+    bool operator==(const TrackedAllocator<U, Tag>&) const noexcept { return true; }
+
+    template<typename U>
+    bool operator!=(const TrackedAllocator<U, Tag>&) const noexcept { return false; }
+};
+
+template<typename T, MemoryTag Tag>
+using TrackedVector = std::vector<T, TrackedAllocator<T, Tag>>;
+
+} // namespace YUGA
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "Memory/MemoryTracker.h"
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace YUGA {
+
+/**
+ * @brief Fixed-size block pool with a free list.
+ *
+ * Blocks are carved out of chunks so objects of the same type sit next to
+ * each other in memory. Chunks are accounted against the pool's memory tag
+ * and are only released when the pool itself is destroyed.
+ */
+template<typename T>
+class ObjectPool {
+public:
+    static constexpr size_t BlocksPerChunk = 64;
+
+    explicit ObjectPool(MemoryTag tag = MemoryTag::General) : m_Tag(tag) {}
+
+    ~ObjectPool() {
+        for (void* chunk : m_Chunks) {
+            MemoryTracker::Free(m_Tag, chunk);
+        }
+    }
+
+    ObjectPool(const ObjectPool&) = delete;
+    ObjectPool& operator=(const ObjectPool&) = delete;
+
+    // Raw uninitialized storage for one T
+    void* Allocate() {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+
+        if (!m_FreeList && !AllocateChunk()) {
+            return nullptr;
+        }
+
+        FreeBlock* block = m_FreeList;
+        m_FreeList = block->next;
+        ++m_LiveCount;
+        return block;
+    }
+
+    void Free(void* memory) {
+        if (!memory) {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(m_Mutex);
+
+        FreeBlock* block = static_cast<FreeBlock*>(memory);
+        block->next = m_FreeList;
+        m_FreeList = block;
+        --m_LiveCount;
+    }
+
+    size_t GetLiveCount() const { return m_LiveCount; }
+    size_t GetCapacity() const { return m_Chunks.size() * BlocksPerChunk; }
+
+private:
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    static constexpr size_t Alignment = alignof(T) > alignof(FreeBlock) ? alignof(T) : alignof(FreeBlock);
+    static constexpr size_t BlockSize = ((sizeof(T) > sizeof(FreeBlock) ? sizeof(T) : sizeof(FreeBlock)) + Alignment - 1) & ~(Alignment - 1);
+
+    bool AllocateChunk() {
+        static_assert(Alignment <= alignof(std::max_align_t), "ObjectPool does not support over-aligned types");
+
+        uint8_t* chunk = static_cast<uint8_t*>(MemoryTracker::Allocate(m_Tag, BlockSize * BlocksPerChunk));
+        if (!chunk) {
+            return false;
+        }
+        m_Chunks.push_back(chunk);
+
+        // Thread the new blocks onto the free list in address order
+        for (size_t i = BlocksPerChunk; i-- > 0;) {
+            FreeBlock* block = reinterpret_cast<FreeBlock*>(chunk + i * BlockSize);
+            block->next = m_FreeList;
+            m_FreeList = block;
+        }
+        return true;
+    }
+
+private:
+    MemoryTag m_Tag;
+    std::mutex m_Mutex;
+    FreeBlock* m_FreeList = nullptr;
+    std::vector<void*> m_Chunks;
+    size_t m_LiveCount = 0;
+};
+
+} // namespace YUGA
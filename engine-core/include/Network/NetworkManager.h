@@ -5,6 +5,8 @@
 #include <functional>
 #include <memory>
 #include <cstdint>
+#include "Memory/MemoryTracker.h"
+#include "Core/Name.h"
 
 namespace YUGA {
 
@@ -32,6 +34,19 @@ struct NetworkMessage {
     NetworkMessage() : type(MessageType::Custom), clientId(0) {}
 };
 
+// Published on the EventBus from HandleMessage()
+struct ClientConnectedEvent {
+    uint32_t clientId;
+};
+
+struct ClientDisconnectedEvent {
+    uint32_t clientId;
+};
+
+struct NetworkMessageEvent {
+    NetworkMessage message;
+};
+
 struct NetworkClient {
     uint32_t id;
     std::string address;
@@ -65,25 +80,20 @@ public:
     void SendToAllExcept(uint32_t excludeId, const NetworkMessage& message);
     
     // RPC (Remote Procedure Call)
-    void RegisterRPC(const std::string& name, std::function<void(uint32_t, const std::vector<uint8_t>&)> callback);
-    void CallRPC(const std::string& name, const std::vector<uint8_t>& data);
-    void CallRPCOnServer(const std::string& name, const std::vector<uint8_t>& data);
-    void CallRPCOnClient(uint32_t clientId, const std::string& name, const std::vector<uint8_t>& data);
-    void CallRPCOnAll(const std::string& name, const std::vector<uint8_t>& data);
+    void RegisterRPC(Name name, std::function<void(uint32_t, const std::vector<uint8_t>&)> callback);
+    void CallRPC(Name name, const std::vector<uint8_t>& data);
+    void CallRPCOnServer(Name name, const std::vector<uint8_t>& data);
+    void CallRPCOnClient(uint32_t clientId, Name name, const std::vector<uint8_t>& data);
+    void CallRPCOnAll(Name name, const std::vector<uint8_t>& data);
     
     // State synchronization
-    void RegisterSyncVar(const std::string& name, void* variable, size_t size);
-    void SyncToServer(const std::string& name);
-    void SyncToClients(const std::string& name);
+    void RegisterSyncVar(Name name, void* variable, size_t size);
+    void SyncToServer(Name name);
+    void SyncToClients(Name name);
     
     // Update
     void Update(float deltaTime);
     
-    // Callbacks
-    void SetOnClientConnected(std::function<void(uint32_t)> callback) { onClientConnected = callback; }
-    void SetOnClientDisconnected(std::function<void(uint32_t)> callback) { onClientDisconnected = callback; }
-    void SetOnMessageReceived(std::function<void(const NetworkMessage&)> callback) { onMessageReceived = callback; }
-    
     // Info
     NetworkMode GetMode() const { return mode; }
     uint32_t GetClientId() const { return myClientId; }
@@ -104,21 +114,16 @@ private:
     void* serverSocket;
     void* clientSocket;
     
-    // RPC system
-    std::unordered_map<std::string, std::function<void(uint32_t, const std::vector<uint8_t>&)>> rpcCallbacks;
+    // RPC system (keyed by name hash, which is also what goes on the wire)
+    std::unordered_map<Name, std::function<void(uint32_t, const std::vector<uint8_t>&)>> rpcCallbacks;
     
     // Sync vars
     struct SyncVar {
         void* variable;
         size_t size;
-        std::vector<uint8_t> lastValue;
+        TrackedVector<uint8_t, MemoryTag::Network> lastValue;
     };
-    std::unordered_map<std::string, SyncVar> syncVars;
-    
-    // Callbacks
-    std::function<void(uint32_t)> onClientConnected;
-    std::function<void(uint32_t)> onClientDisconnected;
-    std::function<void(const NetworkMessage&)> onMessageReceived;
+    std::unordered_map<Name, SyncVar> syncVars;
     
     // Stats
     float ping;
@@ -130,6 +135,7 @@ private:
     void HandleMessage(const NetworkMessage& message);
     void SendMessage(void* socket, const NetworkMessage& message);
     NetworkMessage ReceiveMessage(void* socket);
+    NetworkMessage BuildRPCMessage(Name name, const std::vector<uint8_t>& data) const;
     
     // Lag compensation
     float interpolationDelay;
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "Core/Core.h"
+#include <cstdint>
+#include <vector>
+
+namespace YUGA {
+    
+    class Mesh;
+    class Model;
+    
+    /**
+     * @brief Compact triangle soup gathered from render meshes for collision.
+     *
+     * Only positions and indices are kept. ContentHash identifies the
+     * geometry, so derived data (BVHs, convex decompositions) can be cached
+     * and reused across loads.
+     */
+    struct CollisionMesh {
+        std::vector<float> Positions;   // xyz per vertex
+        std::vector<int> Indices;       // Three per triangle
+        uint64_t ContentHash = 0;
+        
+        size_t GetVertexCount() const { return Positions.size() / 3; }
+        size_t GetTriangleCount() const { return Indices.size() / 3; }
+        bool IsEmpty() const { return Indices.empty(); }
+        
+        static CollisionMesh FromMeshes(const std::vector<const Mesh*>& meshes);
+        static CollisionMesh FromModel(const Model& model);
+    };
+    
+} // namespace YUGA
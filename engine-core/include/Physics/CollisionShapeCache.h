@@ -0,0 +1,104 @@
+#pragma once
+
+#include "Core/Core.h"
+#include "Core/RefCounted.h"
+#include "Math/Vector3.h"
+#include <btBulletDynamicsCommon.h>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+
+namespace YUGA {
+    
+    enum class CollisionShape {
+        Box,
+        Sphere,
+        Capsule,
+        Mesh,           // Static triangle mesh
+        ConvexMesh,     // Compound of convex hulls
+        Heightfield     // Terrain height grid, owned by its TerrainCollider
+    };
+    
+    struct CollisionShapeKey {
+        CollisionShape Type = CollisionShape::Box;
+        Vector3 Size{ 1.0f, 1.0f, 1.0f };   // Primitive size, or scale of a mesh wrapper
+        uint64_t MeshId = 0;                // 0 for primitives
+        
+        bool operator==(const CollisionShapeKey& other) const {
+            return Type == other.Type && MeshId == other.MeshId &&
+                   Size.x == other.Size.x && Size.y == other.Size.y && Size.z == other.Size.z;
+        }
+    };
+    
+    struct CollisionShapeKeyHash {
+        size_t operator()(const CollisionShapeKey& key) const noexcept;
+    };
+    
+    /**
+     * @brief Bullet shape shared by every body with the same key.
+     *
+     * Removes itself from the cache when the last reference goes away. A
+     * scaled wrapper keeps the shape it wraps alive.
+     */
+    class SharedCollisionShape : public RefCountedST {
+    public:
+        static constexpr MemoryTag PoolTag = MemoryTag::Physics;
+        
+        SharedCollisionShape(const CollisionShapeKey& key, std::unique_ptr<btCollisionShape> shape,
+                             Ref<SharedCollisionShape> wrapped = nullptr);
+        ~SharedCollisionShape();
+        
+        btCollisionShape* GetShape() const { return m_Shape.get(); }
+        const CollisionShapeKey& GetKey() const { return m_Key; }
+        
+    private:
+        CollisionShapeKey m_Key;
+        std::unique_ptr<btCollisionShape> m_Shape;
+        Ref<SharedCollisionShape> m_Wrapped;
+    };
+    
+    using CollisionShapeRef = Ref<SharedCollisionShape>;
+    
+    /**
+     * @brief Deduplicates collision shapes by type and dimensions, or by mesh.
+     *
+     * Primitives bake their dimensions into the shape (Bullet handles that
+     * better than scaling); mesh shapes are built once at unit scale and
+     * reused through scaled wrappers. Shapes are acquired and released on
+     * the main thread.
+     */
+    class YUGA_API CollisionShapeCache {
+    public:
+        using ShapeFactory = std::function<std::unique_ptr<btCollisionShape>()>;
+        
+        static CollisionShapeCache& Get();
+        
+        // size: box extents, sphere diameter (x), capsule diameter (x) and height (y)
+        CollisionShapeRef GetPrimitive(CollisionShape type, const Vector3& size);
+        
+        // Mesh-derived shape identified by meshId; factory runs on a miss. A
+        // size other than 1 is for shapes that bake their scale in (compounds)
+        CollisionShapeRef GetMesh(CollisionShape type, uint64_t meshId, const ShapeFactory& factory,
+                                  const Vector3& size = Vector3(1.0f, 1.0f, 1.0f));
+        
+        // Scaled view of a cached mesh shape; the unscaled shape is shared
+        CollisionShapeRef GetScaled(const CollisionShapeRef& shape, const Vector3& scale);
+        
+        size_t GetShapeCount() const { return m_Shapes.size(); }
+        
+    private:
+        CollisionShapeCache() = default;
+        
+        CollisionShapeRef Find(const CollisionShapeKey& key) const;
+        CollisionShapeRef Insert(const CollisionShapeKey& key, std::unique_ptr<btCollisionShape> shape,
+                                 CollisionShapeRef wrapped = nullptr);
+        void Remove(const SharedCollisionShape* shape);
+        
+        friend class SharedCollisionShape;
+        
+        // Weak entries: the cache does not keep shapes alive
+        std::unordered_map<CollisionShapeKey, SharedCollisionShape*, CollisionShapeKeyHash> m_Shapes;
+    };
+    
+} // namespace YUGA
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "Core/Core.h"
+#include "Physics/CollisionShapeCache.h"
+#include "Physics/CollisionMesh.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace YUGA {
+    
+    class Model;
+    
+    struct ConvexDecompositionSettings {
+        uint32_t MaxHulls = 16;
+        uint32_t MaxVerticesPerHull = 32;
+        uint32_t SplitCandidates = 4;   // Split planes tried per axis
+        float MinVolumeGain = 0.01f;    // Stop once the best split removes less than this fraction of hull volume
+        
+        // Decompose at load time, on the calling thread, when the hull cache
+        // is missing or stale; otherwise the collider falls back to its
+        // primitive. Not hashed, the hulls do not depend on it.
+        bool DecomposeOnCacheMiss = false;
+        
+        uint64_t GetHash() const;
+    };
+    
+    struct ConvexHull {
+        std::vector<float> Points;   // xyz, in mesh space
+        
+        size_t GetPointCount() const { return Points.size() / 3; }
+    };
+    
+    /**
+     * @brief Approximates a mesh by a few convex hulls for dynamic bodies.
+     *
+     * Decompose() recursively splits the mesh with the axis-aligned plane that
+     * removes the most hull volume, until MaxHulls is reached or splitting no
+     * longer pays off, then caps each hull at MaxVerticesPerHull. It is meant
+     * to run in the asset pipeline (BuildCache); at load time CreateShape()
+     * reads the cached hulls, keyed by mesh content hash and settings, and
+     * builds a btCompoundShape of btConvexHullShape children. A cache miss
+     * only decomposes at load time with DecomposeOnCacheMiss set.
+     *
+     * The compound's origin is the hulls' center of mass, at uniform density,
+     * and its axes are their principal axes, so a body using it rotates about
+     * the right point and gets the right inertia. centerOfMass receives that
+     * frame in the scaled mesh's space; the body goes there.
+     */
+    class YUGA_API ConvexDecomposition {
+    public:
+        static std::vector<ConvexHull> Decompose(const CollisionMesh& mesh, const ConvexDecompositionSettings& settings = {});
+        
+        // Hull cache files
+        static bool SaveHulls(const std::string& path, uint64_t contentHash, const ConvexDecompositionSettings& settings,
+                              const std::vector<ConvexHull>& hulls);
+        static bool LoadHulls(const std::string& path, uint64_t contentHash, const ConvexDecompositionSettings& settings,
+                              std::vector<ConvexHull>& hulls);
+        static std::string GetCachePath(const std::string& assetPath) { return assetPath + ".hulls"; }
+        
+        // Asset pipeline step: decompose the model and write its cache file
+        static bool BuildCache(const Model& model, const ConvexDecompositionSettings& settings = {});
+        
+        // Compound shape shared through CollisionShapeCache; null on a cache
+        // miss unless DecomposeOnCacheMiss, which decomposes and writes the
+        // cache. scale is baked into the hulls.
+        static CollisionShapeRef CreateShape(const CollisionMesh& mesh, const std::string& cachePath,
+                                             const ConvexDecompositionSettings& settings = {},
+                                             const Vector3& scale = Vector3(1.0f, 1.0f, 1.0f),
+                                             btTransform* centerOfMass = nullptr);
+        static CollisionShapeRef CreateShapeForModel(const Model& model, const ConvexDecompositionSettings& settings = {},
+                                                     const Vector3& scale = Vector3(1.0f, 1.0f, 1.0f),
+                                                     btTransform* centerOfMass = nullptr);
+    };
+    
+} // namespace YUGA
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "Math/Vector3.h"
+#include "Math/Quaternion.h"
+#include "Physics/CollisionShapeCache.h"
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace YUGA {
+    
+    // Entity of a body without one (e.g. terrain); equal to entt::null
+    constexpr uint32_t NullQueryEntity = UINT32_MAX;
+    
+    struct RayQuery {
+        Vector3 From;
+        Vector3 To;
+        int CollisionMask = -1;                     // Bullet collision filter mask
+        uint32_t IgnoreEntity = NullQueryEntity;
+    };
+    
+    // Box, Sphere or Capsule, sized as for CollisionShapeCache::GetPrimitive()
+    struct SweepQuery {
+        CollisionShape Shape = CollisionShape::Sphere;
+        Vector3 Size{ 1.0f, 1.0f, 1.0f };
+        Vector3 From;
+        Vector3 To;
+        Quaternion Rotation = Quaternion::Identity();
+        int CollisionMask = -1;
+        uint32_t IgnoreEntity = NullQueryEntity;
+    };
+    
+    struct OverlapQuery {
+        CollisionShape Shape = CollisionShape::Sphere;
+        Vector3 Size{ 1.0f, 1.0f, 1.0f };
+        Vector3 Position;
+        Quaternion Rotation = Quaternion::Identity();
+        int CollisionMask = -1;
+        uint32_t IgnoreEntity = NullQueryEntity;
+    };
+    
+    struct QueryHit {
+        uint32_t Entity = NullQueryEntity;   // From the body's Bullet user index
+        Vector3 Point;
+        Vector3 Normal;                      // Points out of the hit body
+        float Fraction = 1.0f;               // Along the ray or sweep; 0 for overlaps
+        bool Hit = false;
+    };
+    
+    // The hits of one overlap query in the batch's hit array
+    struct QueryHitRange {
+        uint32_t First = 0;
+        uint32_t Count = 0;
+    };
+    
+    // hits[i] answers queries[i]
+    using QueryCallback = std::function<void(const std::vector<QueryHit>& hits)>;
+    
+    // Overlap query i's hits are hits[ranges[i].First, ranges[i].First + ranges[i].Count)
+    using OverlapQueryCallback = std::function<void(const std::vector<QueryHit>& hits, const std::vector<QueryHitRange>& ranges)>;
+    
+} // namespace YUGA
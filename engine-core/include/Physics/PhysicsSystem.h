@@ -0,0 +1,80 @@
+#pragma once
+
+#include "Core/Core.h"
+#include "Math/Vector3.h"
+#include "Math/Quaternion.h"
+#include "Physics/CollisionShapeCache.h"
+#include "Physics/ConvexDecomposition.h"
+#include <entt/entt.hpp>
+#include <vector>
+
+namespace YUGA {
+    
+    class PhysicsWorld;
+    class RigidBody;
+    struct ColliderComponent;
+    struct TransformComponent;
+    
+    // Runtime body owned by the physics system, attached next to RigidBodyComponent
+    struct PhysicsBodyState {
+        Ref<RigidBody> Body;
+        Vector3 SyncedPosition{ 0.0f, 0.0f, 0.0f };   // Last value exchanged with physics
+        Vector3 SyncedRotation{ 0.0f, 0.0f, 0.0f };
+        
+        // The body's frame in the entity's: the scaled collider center, moved
+        // to the center of mass of a ConvexMesh compound
+        Vector3 BodyOffset{ 0.0f, 0.0f, 0.0f };
+        Quaternion BodyRotation = Quaternion::Identity();
+    };
+    
+    /**
+     * @brief Keeps RigidBodyComponent/ColliderComponent and the physics world in sync.
+     *
+     * Bodies are created and destroyed from registry signals, batched at the
+     * next PushTransforms(). Changing either component through
+     * registry.patch()/replace() rebuilds the body. Per frame:
+     *  - PullTransforms() copies the transforms moved by the last published
+     *    step into TransformComponent (sleeping bodies are never visited)
+     *  - PushTransforms() sends the transforms game code changed since the
+     *    last exchange (kinematic movement, teleports) to the world
+     *
+     * A body sits at its collider's Center rather than the entity origin,
+     * and a convex compound's body at the compound's center of mass, so
+     * off-center shapes are placed, and rotate, correctly.
+     */
+    class YUGA_API PhysicsSystem {
+    public:
+        PhysicsSystem(PhysicsWorld& world, entt::registry& registry);
+        ~PhysicsSystem();
+        
+        void PullTransforms();
+        void PushTransforms();
+        
+        size_t GetBodyCount() const { return m_BodyCount; }
+        
+        // Used for ConvexMesh colliders created from now on; must match the
+        // settings their hull caches were built with
+        void SetConvexDecompositionSettings(const ConvexDecompositionSettings& settings) { m_DecompositionSettings = settings; }
+        
+    private:
+        void OnBodyAdded(entt::registry& registry, entt::entity entity);
+        void OnBodyRemoved(entt::registry& registry, entt::entity entity);
+        void OnBodyChanged(entt::registry& registry, entt::entity entity);
+        
+        void ApplyPendingChanges();
+        void CreateBody(entt::entity entity);
+        CollisionShapeRef CreateShape(entt::entity entity, const ColliderComponent* collider,
+                                      const TransformComponent& transform, btTransform& centerOfMass);
+        void DestroyBody(entt::entity entity);
+        
+    private:
+        PhysicsWorld& m_World;
+        entt::registry& m_Registry;
+        
+        std::vector<entt::entity> m_PendingCreates;
+        std::vector<Ref<RigidBody>> m_PendingDestroys;
+        size_t m_BodyCount = 0;
+        ConvexDecompositionSettings m_DecompositionSettings;
+    };
+    
+} // namespace YUGA
@@ -1,47 +1,250 @@
 #pragma once
 
 #include "Core/Core.h"
+#include "Math/Vector3.h"
+#include "Math/Quaternion.h"
+#include "Physics/PhysicsQuery.h"
 #include <btBulletDynamicsCommon.h>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include <vector>
 
 namespace YUGA {
     
     class RigidBody;
+    class RigidBodyMotionState;
+    
+    enum class PhysicsMode {
+        Synchronous,    // Update() steps the world in place
+        Asynchronous    // Steps run on a dedicated thread, one frame behind gameplay
+    };
+    
+    struct PhysicsWorldConfig {
+        // Bullet's multithreaded world: collision dispatch, integration and
+        // per-island solving run on JobSystem workers. Needs Bullet built
+        // with BT_THREADSAFE, the JobSystem running and InstallGlobalHooks()
+        // called; falls back to the single-threaded world otherwise.
+        bool Multithreaded = false;
+        
+        // Lockstep: whole FixedTimeStep steps only, bodies added in entity
+        // order, single-threaded solving, and a state hash after every step.
+        // Identical inputs on identical builds give bit-identical results,
+        // given steps driven by UpdateSteps() and inputs queued for a step.
+        bool Deterministic = false;
+        float FixedTimeStep = 1.0f / 60.0f;
+    };
+    
+    // World state after a deterministic step, for desync detection
+    struct PhysicsStepHash {
+        uint64_t Step = 0;
+        uint64_t Hash = 0;
+    };
+    
+    // Per-step counters, published with the step's transforms
+    struct PhysicsStats {
+        uint32_t ActiveBodies = 0;
+        uint32_t ActiveIslands = 0;       // Islands containing an awake body
+        uint32_t LargestIsland = 0;       // Bodies in the biggest active island
+        uint32_t Manifolds = 0;
+        uint32_t ContactPoints = 0;
+        uint32_t Constraints = 0;
+        uint32_t SolverGroups = 0;        // solveGroup calls (island batches)
+        uint32_t Threads = 1;
+        float StepMilliseconds = 0.0f;
+        float BroadphaseMilliseconds = 0.0f;   // Overlapping pair update
+        float NarrowphaseMilliseconds = 0.0f;  // Contact generation
+        float SolverMilliseconds = 0.0f;       // Summed over threads
+    };
+    
+    struct PhysicsTransform {
+        Vector3 Position{ 0.0f, 0.0f, 0.0f };
+        Quaternion Rotation = Quaternion::Identity();
+    };
     
     /**
      * @brief Physics simulation world using Bullet3
+     *
+     * In asynchronous mode Update() waits for the step started last frame,
+     * publishes its results and starts the next step on the physics thread,
+     * so the step overlaps with gameplay. Results are double buffered: game
+     * code reads the published buffer while the physics thread fills the
+     * other one. Changes to bodies are queued as commands and applied on the
+     * physics thread before the next step.
+     *
+     * Only bodies Bullet actually moves are written: sleeping, static and
+     * kinematic bodies cost nothing per step. GetMovedSlots() lists the slots
+     * updated by the last published step.
      */
     class PhysicsWorld {
     public:
+        static constexpr uint32_t InvalidSlot = UINT32_MAX;
+        
         PhysicsWorld();
         ~PhysicsWorld();
         
-        void Initialize();
+        // Routes Bullet's allocations through the MemoryTracker and its
+        // parallel loops through the JobSystem. The hooks are process-wide and
+        // outlive any world: call once on the main thread at startup, after
+        // JobSystem::Initialize() and before Bullet allocates anything.
+        static void InstallGlobalHooks();
+        
+        void Initialize(const PhysicsWorldConfig& config = {});
         void Update(float deltaTime);
+        
+        // Runs exactly this many FixedTimeSteps, whatever the frame time.
+        // Lockstep games drive a deterministic world this way, so every peer
+        // takes the same numbered steps. Update() instead runs the whole
+        // steps that frame time has accumulated, at most MaxStepsPerUpdate
+        // at a time, and carries any backlog over.
+        void UpdateSteps(uint32_t steps);
+        void StepOnce() { UpdateSteps(1); }
+        
+        static constexpr uint32_t MaxStepsPerUpdate = 10;
         void Shutdown();
         
-        // Gravity
+        // Mode
+        void SetMode(PhysicsMode mode);
+        PhysicsMode GetMode() const { return m_Mode; }
+        bool IsAsync() const { return m_Mode == PhysicsMode::Asynchronous; }
+        
+        bool IsMultithreaded() const { return m_Multithreaded; }
+        bool IsDeterministic() const { return m_Deterministic; }
+        
+        // Deterministic mode: steps started so far, counting any still in
+        // flight, and the hashes of those taken by the last published update
+        // (oldest first). Steps are numbered from 1, so the next update's
+        // first step is GetStepCount() + 1.
+        uint64_t GetStepCount() const { return m_StepCount; }
+        const std::vector<PhysicsStepHash>& GetStepHashes() const { return m_StepHashes[m_ReadIndex]; }
+        const PhysicsStats& GetStats() const { return m_Stats[m_ReadIndex]; }
+        
+        // Blocks until the in-flight step (if any) has finished
+        void WaitForStep();
+        
+        // Runs before the next step on the physics thread (immediately when synchronous)
+        void QueueCommand(std::function<void()> command);
+        
+        // Deterministic mode: runs right before the given step, after the
+        // commands queued for it earlier. A step already started is too late
+        // for lockstep; the command warns and runs before the next step.
+        // Without deterministic mode steps are not numbered and this is
+        // QueueCommand(command).
+        void QueueCommand(uint64_t step, std::function<void()> command);
+        
+        // Gravity; reads the value last set, which reaches the world with the next step
         void SetGravity(const btVector3& gravity);
-        btVector3 GetGravity() const;
+        btVector3 GetGravity() const { return m_Gravity; }
         
         // Rigid body management
         void AddRigidBody(RigidBody* body);
         void RemoveRigidBody(RigidBody* body);
         
+        // Published transforms, indexed by RigidBody::GetTransformSlot()
+        const std::vector<PhysicsTransform>& GetTransforms() const { return m_Transforms[m_ReadIndex]; }
+        const PhysicsTransform& GetTransform(uint32_t slot) const { return m_Transforms[m_ReadIndex][slot]; }
+        const std::vector<uint32_t>& GetMovedSlots() const { return m_MovedSlots[m_ReadIndex]; }
+        RigidBody* GetSlotBody(uint32_t slot) const { return slot < m_SlotBodies.size() ? m_SlotBodies[slot] : nullptr; }
+        
         // Raycasting
         bool Raycast(const btVector3& from, const btVector3& to, btVector3& hitPoint);
         
+        // Batched queries (main thread). A batch fans out over the job system
+        // while the world is idle: at once when synchronous; when asynchronous,
+        // at the next Update()'s sync point, after the last step is published
+        // and before the next starts. They see the published transforms and
+        // never wait for a step. The callback runs on the main thread.
+        void RaycastBatch(std::vector<RayQuery> queries, QueryCallback onResults);
+        void SweepBatch(std::vector<SweepQuery> queries, QueryCallback onResults);
+        void OverlapBatch(std::vector<OverlapQuery> queries, OverlapQueryCallback onResults);
+        
         btDiscreteDynamicsWorld* GetWorld() { return m_DynamicsWorld.get(); }
         
+    private:
+        void AddPendingBodies();
+        void FlushCommands();
+        void Advance(float deltaTime, uint32_t steps);
+        void Step(float deltaTime, uint32_t steps);
+        void StepFixed(uint32_t steps);
+        void PublishStep();
+        void GatherStats(float stepMilliseconds);
+        uint64_t HashState() const;
+        void RecordTransform(uint32_t slot, const btTransform& transform);
+        void PhysicsThreadLoop();
+        void StopPhysicsThread();
+        
+        // Batched queries against the idle world; PhysicsQuery.cpp
+        void RunQueries(std::function<void()> batch);
+        void RunPendingQueries();
+        void ExecuteRaycasts(const std::vector<RayQuery>& queries, std::vector<QueryHit>& hits) const;
+        void ExecuteSweeps(const std::vector<SweepQuery>& queries, std::vector<QueryHit>& hits) const;
+        void ExecuteOverlaps(const std::vector<OverlapQuery>& queries, std::vector<QueryHit>& hits,
+                             std::vector<QueryHitRange>& ranges) const;
+        
     private:
         std::unique_ptr<btDefaultCollisionConfiguration> m_CollisionConfiguration;
         std::unique_ptr<btCollisionDispatcher> m_Dispatcher;
         std::unique_ptr<btBroadphaseInterface> m_Broadphase;
-        std::unique_ptr<btSequentialImpulseConstraintSolver> m_Solver;
+        std::unique_ptr<btConstraintSolver> m_Solver;       // Solver pool when multithreaded
+        std::unique_ptr<btConstraintSolver> m_SolverMt;     // Splits large islands across threads
         std::unique_ptr<btDiscreteDynamicsWorld> m_DynamicsWorld;
+        bool m_Multithreaded = false;
+        btVector3 m_Gravity{ 0, 0, 0 };   // Main thread copy
+        
+        // Phase timings of the current step. The solvers may run on several
+        // threads at once; the other phases are timed on the stepping thread.
+        uint64_t m_BroadphaseNanoseconds = 0;
+        uint64_t m_NarrowphaseNanoseconds = 0;
+        std::atomic<uint64_t> m_SolverNanoseconds{ 0 };
+        std::atomic<uint32_t> m_SolverGroups{ 0 };
+        PhysicsStats m_Stats[2];
+        std::vector<uint32_t> m_IslandSizes;
+        
+        // Deterministic stepping
+        bool m_Deterministic = false;
+        float m_FixedTimeStep = 1.0f / 60.0f;
+        float m_Accumulator = 0.0f;       // Main thread, frame time not yet stepped
+        bool m_FallingBehind = false;     // Main thread
+        uint64_t m_StepCount = 0;         // Main thread; fixed while the steps it counts run
+        std::vector<PhysicsStepHash> m_StepHashes[2];
+        
+        std::vector<RigidBody*> m_PendingBodies;
+        
+        // Bodies in the world by transform slot, and the double-buffered results
+        std::vector<RigidBody*> m_SlotBodies;
+        std::vector<uint32_t> m_FreeSlots;
+        std::vector<PhysicsTransform> m_Transforms[2];
+        std::vector<uint32_t> m_MovedSlots[2];
+        int m_ReadIndex = 0;
+        
+        // Physics thread
+        PhysicsMode m_Mode = PhysicsMode::Synchronous;
+        std::thread m_Thread;
+        std::mutex m_StepMutex;
+        std::condition_variable m_StepCondition;
+        bool m_StepRequested = false;
+        bool m_StepInFlight = false;
+        bool m_StepUnpublished = false;   // Main thread only
+        bool m_ExitThread = false;
+        float m_StepDeltaTime = 0.0f;
+        uint32_t m_StepSteps = 0;         // Fixed steps requested, deterministic mode
+        
+        struct StepCommand {
+            uint64_t Step;
+            std::function<void()> Command;
+        };
+        
+        std::mutex m_CommandMutex;
+        std::vector<std::function<void()>> m_Commands;
+        std::vector<StepCommand> m_StepCommands;
+        
+        std::vector<std::function<void()>> m_PendingQueries;   // Main thread, run at the sync point
         
-        std::vector<RigidBody*> m_RigidBodies;
+        friend class RigidBodyMotionState;
     };
     
 } // namespace YUGA
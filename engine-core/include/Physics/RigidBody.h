@@ -1,24 +1,50 @@
 #pragma once
 
 #include "Core/Core.h"
+#include "Core/RefCounted.h"
 #include "Math/Vector3.h"
+#include "Physics/CollisionShapeCache.h"
+#include "Physics/PhysicsWorld.h"
 #include <btBulletDynamicsCommon.h>
-#include <memory>
+#include <utility>
 
 namespace YUGA {
     
-    enum class CollisionShape {
-        Box,
-        Sphere,
-        Capsule,
-        Mesh
+    class RigidBody;
+    
+    // Publishes the transforms Bullet writes back for active bodies
+    class RigidBodyMotionState : public btDefaultMotionState {
+    public:
+        RigidBodyMotionState(RigidBody& body, const btTransform& startTransform)
+            : btDefaultMotionState(startTransform), m_Body(body) {}
+        
+        void setWorldTransform(const btTransform& transform) override;
+        
+    private:
+        RigidBody& m_Body;
     };
     
-    class YUGA_API RigidBody {
+    /**
+     * @brief Bullet rigid body owned by game code.
+     *
+     * While its world runs asynchronously, getters return the last published
+     * transform and setters are queued for the physics thread.
+     *
+     * The Bullet body and motion state are stored inline, so CreateRef puts
+     * a whole body in one pooled block. Shapes come from CollisionShapeCache.
+     */
+    class YUGA_API RigidBody : public RefCountedST {
     public:
-        RigidBody(CollisionShape shape, float mass);
+        static constexpr MemoryTag PoolTag = MemoryTag::Physics;
+        
+        // Primitive from the shape cache, see CollisionShapeCache::GetPrimitive()
+        RigidBody(CollisionShape shape, float mass, const Vector3& size = Vector3(1.0f, 1.0f, 1.0f));
+        RigidBody(CollisionShapeRef shape, float mass);
         ~RigidBody();
         
+        RigidBody(const RigidBody&) = delete;
+        RigidBody& operator=(const RigidBody&) = delete;
+        
         void SetPosition(const Vector3& position);
         Vector3 GetPosition() const;
         
@@ -27,6 +53,7 @@ namespace YUGA {
         
         void ApplyForce(const Vector3& force);
         void ApplyImpulse(const Vector3& impulse);
+        void Activate();
         
         void SetMass(float mass);
         float GetMass() const { return m_Mass; }
@@ -34,18 +61,40 @@ namespace YUGA {
         void SetKinematic(bool kinematic);
         bool IsKinematic() const { return m_IsKinematic; }
         
-        btRigidBody* GetBulletBody() { return m_RigidBody.get(); }
+        btRigidBody* GetBulletBody() { return &m_RigidBody; }
+        const btRigidBody* GetBulletBody() const { return &m_RigidBody; }
+        const CollisionShapeRef& GetShape() const { return m_Shape; }
+        
+        PhysicsWorld* GetWorld() const { return m_World; }
+        uint32_t GetTransformSlot() const { return m_TransformSlot; }
         
     private:
-        void CreateCollisionShape(CollisionShape shape);
+        static btRigidBody::btRigidBodyConstructionInfo MakeConstructionInfo(
+            float mass, RigidBodyMotionState* motionState, btCollisionShape* shape);
+        bool ReadsPublishedTransform() const;
+        
+        // Applies a change now, or before the next step once the body is in a world
+        template<typename Fn>
+        void Modify(Fn&& fn) {
+            if (m_World && m_TransformSlot != PhysicsWorld::InvalidSlot) {
+                m_World->QueueCommand(std::forward<Fn>(fn));
+            } else {
+                fn();
+            }
+        }
         
-        CollisionShape m_ShapeType;
+        friend class PhysicsWorld;
+        
+        CollisionShapeRef m_Shape;
         float m_Mass;
         bool m_IsKinematic;
         
-        std::unique_ptr<btCollisionShape> m_CollisionShape;
-        std::unique_ptr<btDefaultMotionState> m_MotionState;
-        std::unique_ptr<btRigidBody> m_RigidBody;
+        // Declaration order matters: the body references the motion state
+        RigidBodyMotionState m_MotionState;
+        btRigidBody m_RigidBody;
+        
+        PhysicsWorld* m_World = nullptr;
+        uint32_t m_TransformSlot = PhysicsWorld::InvalidSlot;
     };
     
 } // namespace YUGA
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "Core/Core.h"
+#include "Physics/CollisionShapeCache.h"
+#include "Terrain/Terrain.h"
+
+namespace YUGA {
+    
+    class PhysicsWorld;
+    class RigidBody;
+    
+    /**
+     * @brief Static heightfield collision over a Terrain's own height buffer.
+     *
+     * btHeightfieldTerrainShape reads Terrain::GetHeightData() in place, so
+     * the collider costs a few bytes per chunk instead of the vertices,
+     * indices and BVH of an equivalent triangle mesh. Terrain edits wait for
+     * the in-flight physics step, then refresh only the raycast bounds of
+     * the edited chunks and wake the bodies resting on them. The shape is
+     * only rebuilt (still without copying heights) when an edit leaves the
+     * height range it was built for, or the terrain scale changes.
+     *
+     * The terrain must outlive the collider; the collider registers itself
+     * as the terrain's listener.
+     */
+    class YUGA_API TerrainCollider : public TerrainListener {
+    public:
+        TerrainCollider(Terrain& terrain, PhysicsWorld& world);
+        ~TerrainCollider() override;
+        
+        TerrainCollider(const TerrainCollider&) = delete;
+        TerrainCollider& operator=(const TerrainCollider&) = delete;
+        
+        RigidBody* GetBody() const { return m_Body.get(); }
+        
+        void OnHeightsChanging(const Terrain& terrain) override;
+        void OnHeightsChanged(const Terrain& terrain, int minX, int minZ, int maxX, int maxZ) override;
+        
+    private:
+        void CreateBody(float minHeight, float maxHeight);
+        void WakeRegion(int minX, int minZ, int maxX, int maxZ);
+        
+    private:
+        Terrain& m_Terrain;
+        PhysicsWorld& m_World;
+        Ref<RigidBody> m_Body;
+        
+        // Bounds the shape was built with
+        float m_MinHeight = 0.0f;
+        float m_MaxHeight = 0.0f;
+        float m_Scale = 1.0f;
+    };
+    
+} // namespace YUGA
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "Core/Core.h"
+#include "Physics/CollisionShapeCache.h"
+#include "Physics/CollisionMesh.h"
+#include <string>
+
+namespace YUGA {
+    
+    class Model;
+    
+    /**
+     * @brief Static triangle-mesh collision (btBvhTriangleMeshShape).
+     *
+     * Building the quantized BVH takes seconds for large level geometry, so
+     * it is serialized to bvhCachePath and memory-mapped on later loads. The
+     * cache is keyed by the mesh content hash and rebuilt when the geometry
+     * changes. Triangle meshes only collide as static bodies (mass 0); scale
+     * them with CollisionShapeCache::GetScaled().
+     */
+    class YUGA_API TriangleMeshCollider {
+    public:
+        // An empty bvhCachePath builds the BVH without caching it
+        static CollisionShapeRef Create(const CollisionMesh& mesh, const std::string& bvhCachePath = "");
+        
+        // All meshes of the model; the BVH is cached next to the model file
+        static CollisionShapeRef CreateForModel(const Model& model);
+        
+        static std::string GetCachePath(const std::string& assetPath) { return assetPath + ".bvh"; }
+    };
+    
+} // namespace YUGA
@@ -0,0 +1,88 @@
+#pragma once
+
+#include "Core/Core.h"
+#include "Math/Vector3.h"
+#include "Physics/TriggerWorld.h"
+#include <entt/entt.hpp>
+#include <vector>
+
+namespace YUGA {
+    
+    struct ColliderComponent;
+    struct TransformComponent;
+    
+    /**
+     * @brief One update's trigger events, published on the EventBus.
+     *
+     * Events are stored back to back (enters, then stays, then exits) in the
+     * frame arena, or in the system should the arena be exhausted, so the
+     * batch is valid for the frame it was published in.
+     * Entities are the registry's, as integers.
+     */
+    struct TriggerEventBatch {
+        const TriggerWorld* world;
+        const TriggerEvent* events;
+        uint32_t enterCount;
+        uint32_t stayCount;
+        uint32_t exitCount;
+        
+        const TriggerEvent* Enters() const { return events; }
+        const TriggerEvent* Stays() const { return events + enterCount; }
+        const TriggerEvent* Exits() const { return events + enterCount + stayCount; }
+    };
+    
+    // Runtime proxies owned by the trigger system
+    struct TriggerVolumeState {
+        TriggerHandle Trigger;
+        Vector3 SyncedPosition{ 0.0f, 0.0f, 0.0f };
+        Vector3 SyncedRotation{ 0.0f, 0.0f, 0.0f };
+    };
+    
+    struct TriggerMoverState {
+        TriggerMoverHandle Mover;
+        Vector3 SyncedPosition{ 0.0f, 0.0f, 0.0f };
+        Vector3 SyncedRotation{ 0.0f, 0.0f, 0.0f };   // Moves an off-center collider
+    };
+    
+    /**
+     * @brief Feeds trigger colliders and moving bodies into a TriggerWorld.
+     *
+     * Triggers are entities with a Box or Sphere ColliderComponent marked
+     * IsTrigger and no RigidBodyComponent; they never reach Bullet. Movers
+     * are entities with a dynamic or kinematic RigidBodyComponent and a
+     * solid collider (or none), tracked by their bounding sphere. Trigger
+     * colliders on rigid bodies and mesh triggers stay Bullet sensors.
+     * Adding, removing or patch()ing either component classifies the
+     * entity again.
+     *
+     * Update() syncs the transforms that changed since the last update,
+     * then publishes one TriggerEventBatch if anything entered, stayed or
+     * exited.
+     */
+    class YUGA_API TriggerSystem {
+    public:
+        explicit TriggerSystem(entt::registry& registry);
+        ~TriggerSystem();
+        
+        void Update();
+        
+        TriggerWorld& GetWorld() { return m_World; }
+        const TriggerWorld& GetWorld() const { return m_World; }
+        
+    private:
+        void OnEntityChanged(entt::registry& registry, entt::entity entity);
+        
+        void ApplyPendingChanges();
+        void RemoveProxies(entt::entity entity);
+        void CreateProxies(entt::entity entity);
+        void SyncTransforms();
+        void PublishEvents();
+        
+    private:
+        entt::registry& m_Registry;
+        TriggerWorld m_World;
+        std::vector<entt::entity> m_PendingChanges;
+        std::vector<TriggerEvent> m_OverflowEvents;   // Batch storage when the frame arena is exhausted
+    };
+
+} // namespace YUGA
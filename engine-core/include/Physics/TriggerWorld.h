@@ -0,0 +1,136 @@
+#pragma once
+
+#include "Core/Core.h"
+#include "Core/Handle.h"
+#include "Math/Quaternion.h"
+#include "Math/Vector3.h"
+#include <cstdint>
+#include <vector>
+
+namespace YUGA {
+    
+    // Entity of a trigger or mover added without one; equal to entt::null
+    constexpr uint32_t NullTriggerEntity = UINT32_MAX;
+    
+    // Sized as for CollisionShapeCache::GetPrimitive(): full box extents, sphere diameter in x
+    enum class TriggerShape {
+        Box,        // Oriented
+        Sphere
+    };
+    
+    // Slot data of TriggerWorld
+    struct TriggerVolume {
+        TriggerShape Shape = TriggerShape::Box;
+        Vector3 Position;
+        Vector3 HalfExtents;        // Box half extents; sphere radius in x
+        Vector3 Axes[3];            // Box axes in world space
+        Vector3 BoundsMin;
+        Vector3 BoundsMax;
+        uint32_t Entity = NullTriggerEntity;
+    };
+    
+    struct TriggerMover {
+        Vector3 Position;
+        float Radius = 0.0f;
+        uint32_t Entity = NullTriggerEntity;
+    };
+    
+    using TriggerHandle = Handle<TriggerVolume>;
+    using TriggerMoverHandle = Handle<TriggerMover>;
+    
+    // One trigger/mover pair; which batch it is in says whether it began, held or ended
+    struct TriggerEvent {
+        TriggerHandle Trigger;
+        TriggerMoverHandle Mover;
+        uint32_t TriggerEntity = NullTriggerEntity;
+        uint32_t MoverEntity = NullTriggerEntity;
+    };
+    
+    /**
+     * @brief Overlap tracking between trigger volumes and moving spheres, without Bullet.
+     *
+     * Triggers (pickups, zones, checkpoints) are boxes or spheres; movers
+     * (players, projectiles, vehicles) are bounding spheres. Update() runs a
+     * sweep-and-prune along x that only pairs triggers with movers, tests
+     * the exact shapes, and diffs the result against the previous update
+     * into enter, stay and exit batches.
+     *
+     * Sorted order is kept between updates, so scenes that move a little
+     * per frame re-sort in near linear time. Removing a trigger or mover
+     * reports exits for its overlaps on the next update, carrying the
+     * entities it was added with.
+     */
+    class YUGA_API TriggerWorld {
+    public:
+        TriggerHandle AddTrigger(TriggerShape shape, const Vector3& size, const Vector3& position,
+                                 const Quaternion& rotation = Quaternion::Identity(),
+                                 uint32_t entity = NullTriggerEntity);
+        void SetTriggerTransform(TriggerHandle trigger, const Vector3& position, const Quaternion& rotation);
+        void RemoveTrigger(TriggerHandle trigger);
+        
+        TriggerMoverHandle AddMover(const Vector3& position, float radius, uint32_t entity = NullTriggerEntity);
+        void SetMoverPosition(TriggerMoverHandle mover, const Vector3& position);
+        void RemoveMover(TriggerMoverHandle mover);
+        
+        // Finds this update's overlaps and fills the event batches
+        void Update();
+        
+        // Batches from the last Update(), each sorted by trigger
+        const std::vector<TriggerEvent>& GetEnterEvents() const { return m_Enters; }
+        const std::vector<TriggerEvent>& GetStayEvents() const { return m_Stays; }
+        const std::vector<TriggerEvent>& GetExitEvents() const { return m_Exits; }
+        
+        size_t GetTriggerCount() const { return m_TriggerSlots.GetCount(); }
+        size_t GetMoverCount() const { return m_MoverSlots.GetCount(); }
+        size_t GetOverlapCount() const { return m_Pairs.size(); }
+        
+        // Drops every trigger and mover without reporting exits
+        void Clear();
+    
+    private:
+        // Sweep entry: the x interval, plus y/z bounds so rejects stay in this array
+        struct Interval {
+            float Min;
+            float Max;
+            float MinY, MaxY;
+            float MinZ, MaxZ;
+            uint32_t Slot;
+            uint32_t Generation;    // Stale once the slot is freed
+        };
+        
+        struct Pair {
+            uint64_t Key;   // Trigger handle in the high half, mover handle in the low half
+            uint32_t TriggerEntity;
+            uint32_t MoverEntity;
+        };
+        
+        template<typename Slot>
+        static void SortIntervals(std::vector<Interval>& intervals, size_t& sortedCount,
+                                  const std::vector<Slot>& slots, const HandleAllocator<Slot>& allocator);
+        void FindOverlaps();
+        void DiffPairs();
+        bool Overlaps(uint32_t triggerSlot, uint32_t moverSlot) const;
+    
+    private:
+        // Slot arrays, indexed by handle
+        std::vector<TriggerVolume> m_Triggers;
+        std::vector<TriggerMover> m_Movers;
+        HandleAllocator<TriggerVolume> m_TriggerSlots;
+        HandleAllocator<TriggerMover> m_MoverSlots;
+        
+        // x intervals in last update's sorted order, followed by the ones
+        // added since; stale entries are dropped on the next sort
+        std::vector<Interval> m_TriggerIntervals;
+        std::vector<Interval> m_MoverIntervals;
+        size_t m_SortedTriggers = 0;
+        size_t m_SortedMovers = 0;
+        
+        std::vector<Pair> m_Pairs;          // Overlaps of the last update, sorted by key
+        std::vector<Pair> m_NewPairs;
+        
+        std::vector<TriggerEvent> m_Enters;
+        std::vector<TriggerEvent> m_Stays;
+        std::vector<TriggerEvent> m_Exits;
+    };
+
+} // namespace YUGA
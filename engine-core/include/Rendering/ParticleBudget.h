@@ -0,0 +1,109 @@
+#pragma once
+#include "Math/Frustum.h"
+#include "Math/Vector3.h"
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace YUGA {
+
+class Camera;
+class ParticleSystem;
+
+struct ParticleBudgetSettings {
+    // Emission is cut, lowest priority first, to stay under this many particles
+    uint32_t maxLiveParticles = std::numeric_limits<uint32_t>::max();
+    
+    // Emitters further than this from the view count as off-screen
+    float cullDistance = std::numeric_limits<float>::max();
+    
+    // Emission scales linearly from 1 at lodStartDistance down to
+    // lodMinEmissionScale at lodEndDistance and beyond
+    float lodStartDistance = std::numeric_limits<float>::max();
+    float lodEndDistance = std::numeric_limits<float>::max();
+    float lodMinEmissionScale = 0.25f;
+    
+    // Off-screen emitters are simulated every this many frames, with the
+    // time they missed; 0 waits until they are visible again
+    uint32_t offscreenUpdateInterval = 8;
+    float offscreenEmissionScale = 1.0f;
+    
+    // Catch-up runs in steps of at most catchUpStep and forgets anything
+    // older than maxCatchUpTime
+    float catchUpStep = 1.0f / 30.0f;
+    float maxCatchUpTime = 2.0f;
+};
+
+struct ParticleBudgetStats {
+    uint32_t visibleEmitters = 0;
+    uint32_t offscreenEmitters = 0;
+    uint32_t catchUpEmitters = 0;       // Simulated with more than one frame of time
+    uint32_t lodReducedEmitters = 0;
+    uint32_t throttledEmitters = 0;     // Emission cut by maxLiveParticles
+};
+
+enum class ParticleUpdateMode : uint8_t {
+    Normal,     // One frame, batched with every other normal emitter
+    Skip,       // Off-screen; the time is owed
+    CatchUp     // Owed time plus this frame, in catchUpStep steps
+};
+
+// Budget state kept per emitter
+struct ParticleEmitterBudget {
+    ParticleUpdateMode mode = ParticleUpdateMode::Normal;
+    bool visible = true;
+    uint32_t skippedFrames = 0;
+    float pendingTime = 0.0f;
+    float stepTime = 0.0f;          // Time to simulate this update
+    float distance = 0.0f;
+    float emissionScale = 1.0f;
+};
+
+struct ParticleBudgetEntry {
+    ParticleSystem* emitter;
+    ParticleEmitterBudget* budget;
+};
+
+/**
+ * @brief Decides each update how much simulation and emission an emitter gets.
+ *
+ * With a view set, each emitter's particle bounds, padded by the particle
+ * size and extended to the emitter itself, are tested against the
+ * frustum and cullDistance. Off-screen emitters skip updates and owe the
+ * time, which is simulated on re-entry or every offscreenUpdateInterval
+ * frames. Distance scales emission down through the LOD range. Finally
+ * maxLiveParticles is shared out in priority order, nearest first within
+ * a priority: each emitter claims the live count it settles at, and no
+ * update emits more than the room left under the cap.
+ *
+ * Without a view nothing is culled or LOD-scaled; the cap still applies.
+ * Bursts from ParticleSystem::Emit() are never blocked, only counted.
+ */
+class ParticleBudget {
+public:
+    void SetSettings(const ParticleBudgetSettings& newSettings) { settings = newSettings; }
+    const ParticleBudgetSettings& GetSettings() const { return settings; }
+    
+    void SetView(const Camera& camera);
+    void SetView(const Matrix4& viewProjection, const Vector3& position);
+    void ClearView() { hasView = false; }
+    
+    // Fills in every entry's mode, stepTime and emissionScale
+    void Plan(std::vector<ParticleBudgetEntry>& entries, uint32_t liveParticles, float deltaTime);
+    
+    const ParticleBudgetStats& GetStats() const { return stats; }
+    
+private:
+    void Classify(ParticleSystem& emitter, ParticleEmitterBudget& budget) const;
+    void ApplyCap(std::vector<ParticleBudgetEntry>& entries, uint32_t liveParticles);
+    
+    ParticleBudgetSettings settings;
+    Frustum frustum;
+    Vector3 viewPosition;
+    bool hasView = false;
+    
+    std::vector<uint32_t> order;
+    ParticleBudgetStats stats;
+};
+
+} // namespace YUGA
@@ -0,0 +1,89 @@
+#pragma once
+#include "Math/Vector3.h"
+#include "Math/Vector4.h"
+#include "Memory/MemoryTracker.h"
+#include <algorithm>
+#include <cstdint>
+
+namespace YUGA {
+
+// One particle, copied out of a ParticleBuffer
+struct Particle {
+    Vector3 position;
+    Vector3 velocity;
+    Vector4 color;
+    float size;
+    float rotation;     // Radians
+    float lifetime;
+    float age;
+    
+    Particle() : size(1.0f), rotation(0.0f), lifetime(1.0f), age(0.0f) {}
+};
+
+/**
+ * @brief Structure-of-arrays particle storage with a dense live range.
+ *
+ * Every attribute is its own float stream, and particles [0, GetCount())
+ * are alive. Emit() appends at the end and Kill() moves the last live
+ * particle into the hole, so emitting, killing and counting are O(1) and
+ * update loops never visit dead slots. Kill() changes the order; code
+ * iterating while killing must revisit the index it just killed.
+ *
+ * Streams are padded to a multiple of StreamAlignment floats and start on
+ * a 32-byte boundary, so they can be processed in whole SIMD blocks.
+ */
+class ParticleBuffer {
+public:
+    static constexpr uint32_t InvalidIndex = UINT32_MAX;
+    static constexpr uint32_t StreamAlignment = 8;
+    
+    enum Stream : uint32_t {
+        PositionX, PositionY, PositionZ,
+        VelocityX, VelocityY, VelocityZ,
+        ColorR, ColorG, ColorB, ColorA,
+        Size,
+        StartSize,      // Size before the over-lifetime curve
+        Rotation,
+        Lifetime,
+        Age,
+        StreamCount
+    };
+    
+    // Drops every live particle
+    void Reserve(uint32_t capacity);
+    void Clear() { count = 0; }
+    
+    // Index of the new particle, or InvalidIndex when full
+    uint32_t Emit() { return count < capacity ? count++ : InvalidIndex; }
+    
+    // Appends up to requested particles after the live range; returns how
+    // many, starting at the old GetCount()
+    uint32_t EmitRange(uint32_t requested) {
+        uint32_t emitted = std::min(requested, capacity - count);
+        count += emitted;
+        return emitted;
+    }
+    
+    void Kill(uint32_t index);
+    
+    float* Get(Stream stream) { return reinterpret_cast<float*>(blocks.data()) + stream * stride; }
+    const float* Get(Stream stream) const { return reinterpret_cast<const float*>(blocks.data()) + stream * stride; }
+    
+    Particle GetParticle(uint32_t index) const;
+    
+    uint32_t GetCount() const { return count; }
+    uint32_t GetCapacity() const { return capacity; }
+    bool IsFull() const { return count == capacity; }
+    
+private:
+    struct alignas(32) Block {
+        float values[StreamAlignment];
+    };
+    
+    TrackedVector<Block, MemoryTag::Particles> blocks;
+    uint32_t count = 0;
+    uint32_t capacity = 0;
+    uint32_t stride = 0;    // Floats per stream
+};
+
+} // namespace YUGA
@@ -0,0 +1,106 @@
+#pragma once
+#include "Math/MathUtils.h"
+#include "Math/Vector4.h"
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace YUGA {
+
+/**
+ * @brief A keyed, piecewise-linear value over a particle's normalized age.
+ *
+ * Age runs from 0 at birth to 1 at death. Keys are kept sorted by time,
+ * the value is held flat before the first and after the last key, and a
+ * curve without keys is zero. Curves are only evaluated when an emitter
+ * bakes them into a ParticleCurveTable, so they may have any number of
+ * keys.
+ */
+template<typename T>
+class ParticleKeyframes {
+public:
+    struct Key {
+        float time;
+        T value;
+    };
+    
+    ParticleKeyframes() = default;
+    ParticleKeyframes(const T& constant) { AddKey(0.0f, constant); }
+    ParticleKeyframes(const T& start, const T& end) {
+        AddKey(0.0f, start);
+        AddKey(1.0f, end);
+    }
+    
+    // A key at an existing time replaces it
+    void AddKey(float time, const T& value) {
+        time = Math::Clamp(time, 0.0f, 1.0f);
+        auto it = std::lower_bound(keys.begin(), keys.end(), time, [](const Key& key, float t) { return key.time < t; });
+        if (it != keys.end() && it->time == time) {
+            it->value = value;
+        } else {
+            keys.insert(it, { time, value });
+        }
+    }
+    
+    void ClearKeys() { keys.clear(); }
+    const std::vector<Key>& GetKeys() const { return keys; }
+    
+    T Evaluate(float time) const {
+        if (keys.empty()) {
+            return T();
+        }
+        if (time <= keys.front().time) {
+            return keys.front().value;
+        }
+        if (time >= keys.back().time) {
+            return keys.back().value;
+        }
+    
+        auto next = std::upper_bound(keys.begin(), keys.end(), time, [](float t, const Key& key) { return t < key.time; });
+        auto previous = next - 1;
+        return Math::Lerp(previous->value, next->value, (time - previous->time) / (next->time - previous->time));
+    }
+    
+private:
+    std::vector<Key> keys;
+};
+
+using ParticleCurve = ParticleKeyframes<float>;
+using ParticleGradient = ParticleKeyframes<Vector4>;
+
+/**
+ * @brief A curve sampled at Resolution evenly spaced ages.
+ *
+ * The particle update finds a value by lerping the two samples around
+ * the age, whatever the shape or key count of the curve it came from.
+ * Straight lines, such as a two-key fade, are flagged linear and computed
+ * from the age directly, and constant ones are skipped.
+ */
+struct ParticleCurveTable {
+    static constexpr uint32_t Resolution = 64;
+    
+    float values[Resolution];
+    float slope = 0.0f;     // Per unit of age, when linear
+    bool linear = true;
+    bool constant = true;
+    
+    // Samples function(age) at ages 0, 1 / (Resolution - 1), ..., 1
+    template<typename Function>
+    void Bake(Function&& function) {
+        for (uint32_t i = 0; i < Resolution; ++i) {
+            values[i] = function(static_cast<float>(i) / (Resolution - 1));
+        }
+        constant = std::all_of(values, values + Resolution, [&](float value) { return value == values[0]; });
+    
+        slope = values[Resolution - 1] - values[0];
+        float tolerance = 1.0e-6f * std::max(std::abs(values[0]), std::abs(values[Resolution - 1])) + 1.0e-7f;
+        linear = true;
+        for (uint32_t i = 0; i < Resolution && linear; ++i) {
+            linear = std::abs(values[0] + slope * (static_cast<float>(i) / (Resolution - 1)) - values[i]) <= tolerance;
+        }
+    }
+    
+    float GetMax() const { return *std::max_element(values, values + Resolution); }
+};
+
+} // namespace YUGA
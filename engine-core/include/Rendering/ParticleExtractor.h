@@ -0,0 +1,75 @@
+#pragma once
+#include "Math/Vector3.h"
+#include <cstdint>
+#include <vector>
+
+namespace YUGA {
+
+class Camera;
+class ParticleSystem;
+class ParticleWorld;
+
+// One particle as an instanced draw reads it; 24 bytes, no padding
+struct ParticleInstance {
+    float x, y, z;
+    float size;
+    float rotation;     // Radians, for rotating the billboard
+    uint32_t color;     // RGBA8, red in the lowest byte
+};
+
+static_assert(sizeof(ParticleInstance) == 24, "ParticleInstance must stay tightly packed");
+
+/**
+ * @brief Turns the live particles of a frame into a depth-sorted instance buffer.
+ *
+ * Add() the emitters to draw, then Write() compacts their live particles
+ * into ParticleInstances, sorts them back to front along the view
+ * direction for alpha blending, and writes them out. Nothing here touches
+ * a graphics API, so the destination can be a mapped GPU buffer or plain
+ * memory.
+ *
+ * The sort is an LSD radix sort on 32-bit depth keys, stable, so particles
+ * at equal depth keep emitter and spawn order. Gathering, each radix pass
+ * and the final copy are split into batches on the JobSystem.
+ */
+class ParticleExtractor {
+public:
+    // Particles per batch for every parallel step
+    static constexpr uint32_t ParticlesPerJob = 16384;
+    
+    void SetView(const Camera& camera);
+    void SetView(const Vector3& position, const Vector3& forward);
+    
+    // Forgets the emitters added for the last frame
+    void Clear() { sources.clear(); }
+    
+    // The emitters must outlive the next Write(); empty ones are ignored
+    void Add(const ParticleSystem& emitter);
+    void Add(ParticleWorld& world);
+    
+    uint32_t GetParticleCount() const;
+    
+    // Writes at most capacity instances, farthest first, and returns how
+    // many. When they do not all fit, the farthest are dropped. The
+    // destination is written once, front to back, and never read, which
+    // suits write-combined memory.
+    uint32_t Write(ParticleInstance* destination, uint32_t capacity);
+    
+private:
+    void Gather(uint32_t count);
+    void Sort(uint32_t count);
+    
+    Vector3 viewPosition;
+    Vector3 viewForward = Vector3::Forward();
+    
+    std::vector<const ParticleSystem*> sources;
+    
+    // Scratch, kept between frames
+    std::vector<uint32_t> sourceStarts;     // First instance of each source, plus the total
+    std::vector<ParticleInstance> instances;
+    std::vector<uint64_t> keys;             // Depth key in the high half, instance index in the low
+    std::vector<uint64_t> sortedKeys;
+    std::vector<uint32_t> histograms;       // Per batch, per digit
+};
+
+} // namespace YUGA
@@ -1,23 +1,14 @@
 #pragma once
+#include "Core/RefCounted.h"
 #include "Math/Vector3.h"
 #include "Math/Vector4.h"
 #include "Math/Transform.h"
-#include <vector>
+#include "Math/Random.h"
+#include "Rendering/ParticleBuffer.h"
+#include "Rendering/ParticleCurve.h"
 
 namespace YUGA {
 
-struct Particle {
-    Vector3 position;
-    Vector3 velocity;
-    Vector4 color;
-    float size;
-    float lifetime;
-    float age;
-    bool active;
-    
-    Particle() : size(1.0f), lifetime(1.0f), age(0.0f), active(false) {}
-};
-
 struct ParticleEmitterSettings {
     // Emission
     float emissionRate;      // Particles per second
@@ -30,11 +21,22 @@ struct ParticleEmitterSettings {
     float startSpeed;
     float startSize;
     Vector4 startColor;
+    float startRotation;     // Degrees
     
     // Randomness ranges
     float lifetimeVariation;
     float speedVariation;
     float sizeVariation;
+    float rotationVariation;
+    
+    // Over lifetime, by age from 0 at birth to 1 at death. SetSettings
+    // bakes these into tables, so they may be as detailed as needed.
+    ParticleGradient colorOverLifetime;     // Multiplies startColor
+    ParticleCurve sizeOverLifetime;         // Multiplies each particle's start size
+    ParticleCurve velocityOverLifetimeX;    // Added to the velocity, in units per second
+    ParticleCurve velocityOverLifetimeY;
+    ParticleCurve velocityOverLifetimeZ;
+    ParticleCurve rotationOverLifetime;     // Degrees per second
     
     // Physics
     Vector3 gravity;
@@ -52,6 +54,12 @@ struct ParticleEmitterSettings {
     Vector3 shapeSize;
     float coneAngle;
     
+    // Random stream; 0 gives each emitter its own seed
+    uint32_t randomSeed;
+    
+    // Higher priorities keep emitting first under a ParticleWorld budget
+    int priority;
+    
     ParticleEmitterSettings()
         : emissionRate(10.0f)
         , maxParticles(100)
@@ -61,24 +69,43 @@ struct ParticleEmitterSettings {
         , startSpeed(5.0f)
         , startSize(1.0f)
         , startColor(1.0f, 1.0f, 1.0f, 1.0f)
+        , startRotation(0.0f)
         , lifetimeVariation(0.0f)
         , speedVariation(0.0f)
         , sizeVariation(0.0f)
+        , rotationVariation(0.0f)
+        , colorOverLifetime(Vector4(1.0f, 1.0f, 1.0f, 1.0f), Vector4(1.0f, 1.0f, 1.0f, 0.0f))
+        , sizeOverLifetime(1.0f)
         , gravity(0.0f, -9.81f, 0.0f)
         , drag(0.0f)
         , shape(EmissionShape::Point)
         , shapeRadius(1.0f)
         , shapeSize(1.0f, 1.0f, 1.0f)
         , coneAngle(25.0f)
+        , randomSeed(0)
+        , priority(0)
     {}
 };
 
-class ParticleSystem {
+// An emitter's over-lifetime curves as baked by SetSettings
+struct ParticleLifetimeTables {
+    ParticleCurveTable color[4];    // startColor applied
+    ParticleCurveTable size;
+    ParticleCurveTable velocity[3];
+    ParticleCurveTable rotation;    // Radians per second
+};
+
+class ParticleSystem : public RefCountedST {
+    friend class ParticleWorld;
+    
 public:
+    static constexpr MemoryTag PoolTag = MemoryTag::Particles;
+    
     ParticleSystem();
     ~ParticleSystem() = default;
     
-    // Control
+    // Control; Play() restarts the random stream, so playing again from
+    // a cleared state replays the effect exactly
     void Play();
     void Stop();
     void Pause();
@@ -87,6 +114,9 @@ public:
     // Update
     void Update(float deltaTime);
     
+    // Spawns up to count particles now, on top of the emission rate
+    void Emit(int count);
+    
     // Settings
     void SetSettings(const ParticleEmitterSettings& settings);
     const ParticleEmitterSettings& GetSettings() const { return settings; }
@@ -95,16 +125,27 @@ public:
     Transform& GetTransform() { return transform; }
     const Transform& GetTransform() const { return transform; }
     
-    // Particles
-    const std::vector<Particle>& GetParticles() const { return particles; }
-    int GetActiveParticleCount() const;
+    // Particles; the live ones are [0, GetActiveParticleCount())
+    const ParticleBuffer& GetParticles() const { return particles; }
+    int GetActiveParticleCount() const { return static_cast<int>(particles.GetCount()); }
+    
+    // World-space box around the particles as of the last update; false
+    // when nothing was alive
+    bool GetBounds(Vector3& outMin, Vector3& outMax) const {
+        outMin = boundsMin;
+        outMax = boundsMax;
+        return boundsMin.x <= boundsMax.x;
+    }
+    
+    // Largest size a particle can reach over its lifetime
+    float GetMaxParticleSize() const { return maxParticleSize; }
     
     // State
     bool IsPlaying() const { return playing; }
     bool IsPaused() const { return paused; }
     
 private:
-    std::vector<Particle> particles;
+    ParticleBuffer particles;
     ParticleEmitterSettings settings;
     Transform transform;
     
@@ -113,11 +154,34 @@ private:
     float time;
     float emissionAccumulator;
     
-    void EmitParticle();
-    void UpdateParticle(Particle& particle, float deltaTime);
-    Vector3 GetEmissionPosition() const;
-    Vector3 GetEmissionVelocity() const;
-    float RandomRange(float min, float max) const;
+    Random random;
+    uint32_t instanceSeed;
+    
+    ParticleLifetimeTables lifetimeTables;
+    float maxParticleSize;
+    
+    // Multiplies emissionRate; set by the ParticleWorld budget
+    float emissionScale;
+    
+    Vector3 boundsMin;
+    Vector3 boundsMax;
+    
+    // Update() is Advance() then UpdateParticles(); ParticleWorld runs the
+    // steps itself and splits simulation of large emitters across jobs
+    bool Advance(float deltaTime);
+    void EmitParticles(uint32_t count);
+    void UpdateParticles(float deltaTime);
+    
+    // begin must be a multiple of ParticleBuffer::StreamAlignment; the
+    // range's bounds are returned rather than stored
+    void SimulateParticles(uint32_t begin, uint32_t end, float deltaTime, Vector3& rangeMin, Vector3& rangeMax);
+    void KillExpiredParticles();
+    void KillLanes(uint32_t block, uint32_t lanes);
+    void ResetBounds();
+    void GrowBounds(const Vector3& min, const Vector3& max);
+    void ResetRandom();
+    void BakeCurves();
+    Vector3 SampleShape(float u0, float u1, float u2) const;
 };
 
 } // namespace YUGA
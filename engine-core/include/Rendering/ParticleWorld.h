@@ -0,0 +1,93 @@
+#pragma once
+#include "Core/Core.h"
+#include "Core/Handle.h"
+#include "Rendering/ParticleBudget.h"
+#include "Rendering/ParticleSystem.h"
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace YUGA {
+
+using ParticleEmitterHandle = Handle<ParticleSystem>;
+
+struct ParticleWorldStats {
+    uint32_t emitters = 0;          // Alive in the world
+    uint32_t activeEmitters = 0;    // Updated in the batched steps, not skipped or caught up
+    uint32_t liveParticles = 0;
+    uint32_t simulationJobs = 0;    // Batches the particle update was split into
+    float updateMilliseconds = 0.0f;
+};
+
+/**
+ * @brief Owns every particle emitter and updates them together on the JobSystem.
+ *
+ * An update runs in three parallel steps: each emitter advances its clock
+ * and emits, the live particles of all emitters are integrated in batches
+ * of about ParticlesPerJob particles, and each emitter removes its dead
+ * particles. Batches are cut by particle count, not by emitter, so a
+ * single large effect is spread over several workers while hundreds of
+ * small ones share a batch. Without an initialized JobSystem everything
+ * runs on the caller.
+ *
+ * Before that, the ParticleBudget decides per emitter whether it runs
+ * normally, is skipped while off-screen, or catches up on skipped time,
+ * and how much it may emit. Catch-ups run in the first step as a series
+ * of ordinary updates.
+ *
+ * Emitters are created stopped, like a standalone ParticleSystem; Play()
+ * them through GetEmitter().
+ */
+class ParticleWorld {
+public:
+    // A multiple of the SIMD width, so every batch starts on a block
+    static constexpr uint32_t ParticlesPerJob = 8192;
+    
+    ParticleEmitterHandle CreateEmitter(const ParticleEmitterSettings& settings);
+    void DestroyEmitter(ParticleEmitterHandle handle);
+    void Clear();
+    
+    // Null once the emitter is destroyed
+    ParticleSystem* GetEmitter(ParticleEmitterHandle handle);
+    const ParticleSystem* GetEmitter(ParticleEmitterHandle handle) const;
+    
+    // The callback may not create or destroy emitters
+    void ForEachEmitter(const std::function<void(ParticleEmitterHandle, ParticleSystem&)>& callback);
+    
+    void Update(float deltaTime);
+    
+    // Culling, LOD and the live-particle cap; set its view every frame
+    ParticleBudget& GetBudget() { return budget; }
+    const ParticleBudget& GetBudget() const { return budget; }
+    
+    uint32_t GetEmitterCount() const { return static_cast<uint32_t>(emitters.GetCount()); }
+    const ParticleWorldStats& GetStats() const { return stats; }
+    
+private:
+    // Particles [begin, end) of one emitter
+    struct SimulationRange {
+        ParticleSystem* emitter;
+        uint32_t begin;
+        uint32_t end;
+        Vector3 boundsMin;
+        Vector3 boundsMax;
+    };
+    
+    void BuildSimulationJobs();
+    
+    HandlePool<ParticleSystem> emitters;
+    std::vector<ParticleEmitterBudget> budgets;     // By handle index
+    
+    ParticleBudget budget;
+    
+    // Per-update scratch, kept to avoid reallocating every frame
+    std::vector<ParticleBudgetEntry> entries;
+    std::vector<uint8_t> advanced;
+    std::vector<ParticleSystem*> simulated;
+    std::vector<SimulationRange> ranges;
+    std::vector<uint32_t> jobStarts;    // First range of each job, plus an end marker
+    
+    ParticleWorldStats stats;
+};
+
+} // namespace YUGA
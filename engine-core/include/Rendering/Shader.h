@@ -1,14 +1,17 @@
 #pragma once
 
 #include "Core/Core.h"
+#include "Core/Name.h"
 #include "Math/Vector3.h"
 #include <string>
 #include <unordered_map>
 
 namespace YUGA {
 
-class Shader {
+class Shader : public RefCounted {
 public:
+    static constexpr MemoryTag PoolTag = MemoryTag::Assets;
+    
     Shader(const std::string& vertexSrc, const std::string& fragmentSrc);
     ~Shader();
     
@@ -16,20 +19,21 @@ public:
     void Unbind() const;
     
     // Uniform setters
-    void SetInt(const std::string& name, int value);
-    void SetFloat(const std::string& name, float value);
-    void SetFloat3(const std::string& name, const Vector3& value);
-    void SetFloat4(const std::string& name, float x, float y, float z, float w);
+    // Pass YUGA_NAME("u_Uniform") or a cached Name to keep string hashing off the frame
+    void SetInt(Name name, int value);
+    void SetFloat(Name name, float value);
+    void SetFloat3(Name name, const Vector3& value);
+    void SetFloat4(Name name, float x, float y, float z, float w);
     
     uint32_t GetRendererID() const { return m_RendererID; }
     
 private:
     uint32_t CompileShader(uint32_t type, const std::string& source);
-    int GetUniformLocation(const std::string& name);
+    int GetUniformLocation(Name name);
     
 private:
     uint32_t m_RendererID;
-    std::unordered_map<std::string, int> m_UniformLocationCache;
+    std::unordered_map<Name, int> m_UniformLocationCache;
 };
 
 } // namespace YUGA
@@ -7,6 +7,10 @@
 
 namespace YUGA {
     
+    class PhysicsWorld;
+    class PhysicsSystem;
+    class TriggerSystem;
+    
     class YUGA_API Scene {
     public:
         Scene(const std::string& name = "Untitled");
@@ -20,9 +24,18 @@ namespace YUGA {
         
         const std::string& GetName() const { return m_Name; }
         
+        // Creates bodies for RigidBodyComponents and keeps transforms in sync
+        // with the given world (nullptr disables it)
+        void SetPhysicsWorld(PhysicsWorld* world);
+        
+        // Trigger colliders without a rigid body, see TriggerSystem
+        TriggerSystem& GetTriggerSystem() { return *m_TriggerSystem; }
+        
     private:
         std::string m_Name;
         entt::registry m_Registry;
+        Scope<PhysicsSystem> m_PhysicsSystem;
+        Scope<TriggerSystem> m_TriggerSystem;
         
         friend class Entity;
     };
@@ -30,6 +30,7 @@ namespace YUGA {
         
     private:
         static void RegisterEngineFunctions();
+        static void* LuaAllocator(void* userData, void* ptr, size_t oldSize, size_t newSize);
         
         static lua_State* s_LuaState;
     };
@@ -8,6 +8,20 @@
 
 namespace YUGA {
 
+class Terrain;
+
+// Notified around height edits by users of the shared height buffer (e.g.
+// a physics collider reading it in place)
+class TerrainListener {
+public:
+    virtual ~TerrainListener() = default;
+    
+    // Heights are about to be written
+    virtual void OnHeightsChanging(const Terrain& terrain) = 0;
+    // Heights in the inclusive cell range [minX, maxX] x [minZ, maxZ] changed
+    virtual void OnHeightsChanged(const Terrain& terrain, int minX, int minZ, int maxX, int maxZ) = 0;
+};
+
 class Terrain {
 public:
     Terrain(int width, int height, float scale = 1.0f);
@@ -23,18 +37,23 @@ public:
     
     // Mesh generation
     void GenerateMesh();
-    std::shared_ptr<Mesh> GetMesh() const { return mesh; }
+    Ref<Mesh> GetMesh() const { return mesh; }
     
     // Texturing
-    void SetTexture(int layer, std::shared_ptr<Texture> texture);
-    std::shared_ptr<Texture> GetTexture(int layer) const;
+    void SetTexture(int layer, Ref<Texture> texture);
+    Ref<Texture> GetTexture(int layer) const;
     
     // Properties
     int GetWidth() const { return width; }
     int GetHeight() const { return height; }
     float GetScale() const { return scale; }
     
-    void SetScale(float newScale) { scale = newScale; }
+    void SetScale(float newScale);
+    
+    // Row-major (z * width + x) height buffer; its address never changes
+    const float* GetHeightData() const { return heightData.data(); }
+    
+    void SetListener(TerrainListener* newListener) { listener = newListener; }
     
     // Painting
     void Paint(float worldX, float worldZ, int layer, float radius, float strength);
@@ -48,12 +67,16 @@ private:
     float scale;
     
     std::vector<float> heightData;
-    std::vector<std::shared_ptr<Texture>> textures;
-    std::shared_ptr<Mesh> mesh;
+    std::vector<Ref<Texture>> textures;
+    Ref<Mesh> mesh;
+    TerrainListener* listener = nullptr;
     
     int GetIndex(int x, int z) const { return z * width + x; }
     bool IsValid(int x, int z) const { return x >= 0 && x < width && z >= 0 && z < height; }
     
+    void NotifyChanging() const;
+    void NotifyChanged(int minX, int minZ, int maxX, int maxZ) const;
+    
     void GenerateVertices(std::vector<float>& vertices, std::vector<float>& normals, 
                          std::vector<float>& texCoords, std::vector<unsigned int>& indices);
 };
@@ -1,4 +1,5 @@
 #pragma once
+#include "Core/Core.h"
 #include "Math/Vector2.h"
 #include "Math/Vector4.h"
 #include <string>
@@ -19,7 +20,8 @@ enum class UIAnchor {
     BottomRight
 };
 
-class UIElement {
+// UI is built and updated on the main thread only, so elements use a non-atomic count
+class UIElement : public RefCountedST {
 public:
     UIElement() : position(0, 0), size(100, 100), anchor(UIAnchor::TopLeft), visible(true) {}
     virtual ~UIElement() = default;
@@ -36,11 +38,11 @@ public:
     bool visible;
     
     // Hierarchy
-    void AddChild(std::shared_ptr<UIElement> child) { children.push_back(child); }
-    const std::vector<std::shared_ptr<UIElement>>& GetChildren() const { return children; }
+    void AddChild(Ref<UIElement> child) { children.push_back(child); }
+    const std::vector<Ref<UIElement>>& GetChildren() const { return children; }
     
 protected:
-    std::vector<std::shared_ptr<UIElement>> children;
+    std::vector<Ref<UIElement>> children;
 };
 
 class UIText : public UIElement {
@@ -90,8 +92,8 @@ public:
     void Update(float deltaTime);
     void Render();
     
-    void AddElement(std::shared_ptr<UIElement> element);
-    void RemoveElement(std::shared_ptr<UIElement> element);
+    void AddElement(Ref<UIElement> element);
+    void RemoveElement(Ref<UIElement> element);
     
     int GetWidth() const { return width; }
     int GetHeight() const { return height; }
@@ -99,7 +101,7 @@ public:
 private:
     int width;
     int height;
-    std::vector<std::shared_ptr<UIElement>> elements;
+    std::vector<Ref<UIElement>> elements;
 };
 
 } // namespace YUGA
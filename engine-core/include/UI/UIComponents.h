@@ -211,7 +211,7 @@ class TabControl : public UIElement {
 public:
     struct Tab {
         std::string title;
-        std::shared_ptr<UIElement> content;
+        Ref<UIElement> content;
         bool enabled = true;
     };
     
@@ -220,7 +220,7 @@ public:
     void Render() override;
     void Update(float deltaTime) override;
     
-    void AddTab(const std::string& title, std::shared_ptr<UIElement> content);
+    void AddTab(const std::string& title, Ref<UIElement> content);
     void RemoveTab(int index);
     void SetActiveTab(int index);
     int GetActiveTab() const { return activeTabIndex; }
@@ -319,10 +319,10 @@ public:
     
     std::function<void()> onClose;
     
-    void SetContent(std::shared_ptr<UIElement> content);
+    void SetContent(Ref<UIElement> content);
     
 private:
-    std::shared_ptr<UIElement> content;
+    Ref<UIElement> content;
     bool isDragging = false;
     bool isResizing = false;
     Vector2 dragOffset;
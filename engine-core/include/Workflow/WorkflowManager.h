@@ -51,6 +51,16 @@ struct AIGenerationRequest {
         : type(t), prompt(p), language("Lua"), style("Realistic") {}
 };
 
+// Published on the EventBus by WorkflowManager
+struct WorkflowLogEvent {
+    std::string message;
+    bool isError;
+};
+
+struct WorkflowStepChangedEvent {
+    WorkflowStep step;
+};
+
 // Workflow Manager - Orchestrates the complete development workflow
 class WorkflowManager {
 public:
@@ -109,14 +119,9 @@ public:
     
     // Workflow State
     WorkflowStep GetCurrentStep() const { return currentStep; }
-    void SetCurrentStep(WorkflowStep step) { currentStep = step; }
+    void SetCurrentStep(WorkflowStep step);
     float GetProjectProgress() const;
     
-    // Callbacks
-    std::function<void(const std::string&)> onLog;
-    std::function<void(const std::string&)> onError;
-    std::function<void(WorkflowStep)> onStepChanged;
-    
 private:
     WorkflowStep currentStep;
     std::string currentProjectPath;
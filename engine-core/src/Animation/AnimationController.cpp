@@ -1,13 +1,15 @@
 #include "Animation/AnimationController.h"
 #include "Math/MathUtils.h"
 #include "Core/Log.h"
+#include "Memory/FrameAllocator.h"
+#include "Core/EventBus.h"
 
 namespace YUGA {
 
 // AnimationStateMachine implementation
-void AnimationStateMachine::AddState(const std::string& name, const std::string& clipName) {
+void AnimationStateMachine::AddState(Name name, Name clipName) {
     stateToClip[name] = clipName;
-    if (currentState.empty()) {
+    if (currentState.IsNone()) {
         currentState = name;
     }
 }
@@ -16,20 +18,20 @@ void AnimationStateMachine::AddTransition(const AnimationTransition& transition)
     transitions.push_back(transition);
 }
 
-void AnimationStateMachine::SetParameter(const std::string& name, bool value) {
+void AnimationStateMachine::SetParameter(Name name, bool value) {
     boolParameters[name] = value;
 }
 
-void AnimationStateMachine::SetParameter(const std::string& name, float value) {
+void AnimationStateMachine::SetParameter(Name name, float value) {
     floatParameters[name] = value;
 }
 
-std::string AnimationStateMachine::GetTargetClip() const {
+Name AnimationStateMachine::GetTargetClip() const {
     auto it = stateToClip.find(currentState);
     if (it != stateToClip.end()) {
         return it->second;
     }
-    return "";
+    return Name();
 }
 
 void AnimationStateMachine::Update(float deltaTime) {
@@ -42,7 +44,7 @@ void AnimationStateMachine::Update(float deltaTime) {
     }
 }
 
-bool AnimationStateMachine::EvaluateCondition(const std::string& condition) const {
+bool AnimationStateMachine::EvaluateCondition(Name condition) const {
     // Simple condition evaluation (can be expanded)
     auto boolIt = boolParameters.find(condition);
     if (boolIt != boolParameters.end()) {
@@ -62,8 +64,8 @@ void BlendTree::SetBlendParameter(float x, float y) {
     CalculateWeights();
 }
 
-std::vector<std::pair<std::string, float>> BlendTree::GetActiveClips() const {
-    std::vector<std::pair<std::string, float>> result;
+std::vector<std::pair<Name, float>> BlendTree::GetActiveClips() const {
+    std::vector<std::pair<Name, float>> result;
     for (const auto& node : nodes) {
         if (node.weight > 0.001f) {
             result.push_back({node.clipName, node.weight});
@@ -103,23 +105,22 @@ AnimationController::AnimationController()
     , blendDuration(0.0f)
     , useStateMachine(false)
     , useBlendTree(false)
-    , eventCallback(nullptr)
 {
 }
 
-void AnimationController::AddClip(const std::string& name, const AnimationClip& clip) {
+void AnimationController::AddClip(Name name, const AnimationClip& clip) {
     clips[name] = clip;
 }
 
-void AnimationController::RemoveClip(const std::string& name) {
+void AnimationController::RemoveClip(Name name) {
     clips.erase(name);
 }
 
-bool AnimationController::HasClip(const std::string& name) const {
+bool AnimationController::HasClip(Name name) const {
     return clips.find(name) != clips.end();
 }
 
-void AnimationController::Play(const std::string& clipName, float fadeTime) {
+void AnimationController::Play(Name clipName, float fadeTime) {
     if (!HasClip(clipName)) {
         return;
     }
@@ -134,7 +135,7 @@ void AnimationController::Play(const std::string& clipName, float fadeTime) {
         currentClipName = clipName;
         currentTime = 0.0f;
         state = AnimationState::Playing;
-        nextClipName.clear();
+        nextClipName = Name();
         blendTime = 0.0f;
     }
 }
@@ -161,7 +162,7 @@ void AnimationController::Update(float deltaTime) {
         return;
     }
     
-    if (currentClipName.empty() || !HasClip(currentClipName)) {
+    if (currentClipName.IsNone() || !HasClip(currentClipName)) {
         return;
     }
     
@@ -181,20 +182,22 @@ void AnimationController::Update(float deltaTime) {
     }
     
     // Handle blending
-    if (!nextClipName.empty() && blendDuration > 0.0f) {
+    if (!nextClipName.IsNone() && blendDuration > 0.0f) {
         blendTime += deltaTime;
         if (blendTime >= blendDuration) {
             // Blend complete, switch to next animation
             currentClipName = nextClipName;
             currentTime = 0.0f;
-            nextClipName.clear();
+            nextClipName = Name();
             blendTime = 0.0f;
         }
     }
+    
+    CheckEvents();
 }
 
 float AnimationController::GetNormalizedTime() const {
-    if (currentClipName.empty() || !HasClip(currentClipName)) {
+    if (currentClipName.IsNone() || !HasClip(currentClipName)) {
         return 0.0f;
     }
     
@@ -206,7 +209,7 @@ float AnimationController::GetNormalizedTime() const {
 }
 
 void AnimationController::GetCurrentTransform(Vector3& position, Quaternion& rotation, Vector3& scale) const {
-    if (currentClipName.empty() || !HasClip(currentClipName)) {
+    if (currentClipName.IsNone() || !HasClip(currentClipName)) {
         position = Vector3::Zero();
         rotation = Quaternion::Identity();
         scale = Vector3::One();
@@ -215,7 +218,7 @@ void AnimationController::GetCurrentTransform(Vector3& position, Quaternion& rot
     
     const AnimationClip& currentClip = clips.at(currentClipName);
     
-    if (!nextClipName.empty() && blendDuration > 0.0f) {
+    if (!nextClipName.IsNone() && blendDuration > 0.0f) {
         // Blending between two animations
         const AnimationClip& nextClip = clips.at(nextClipName);
         
@@ -287,10 +290,10 @@ void AnimationController::BlendTransforms(const Vector3& pos1, const Quaternion&
 } // namespace YUGA
 
 void AnimationController::SetSkeleton(const std::vector<Bone>& bones) {
-    skeleton = bones;
+    skeleton.assign(bones.begin(), bones.end());
 }
 
-AnimationClip* AnimationController::GetClip(const std::string& name) {
+AnimationClip* AnimationController::GetClip(Name name) {
     auto it = clips.find(name);
     if (it != clips.end()) {
         return &it->second;
@@ -298,7 +301,7 @@ AnimationClip* AnimationController::GetClip(const std::string& name) {
     return nullptr;
 }
 
-void AnimationController::CrossFade(const std::string& clipName, float fadeTime) {
+void AnimationController::CrossFade(Name clipName, float fadeTime) {
     Play(clipName, fadeTime);
 }
 
@@ -311,7 +314,7 @@ void AnimationController::GetBoneTransforms(std::vector<Vector3>& positions, std
     rotations.resize(skeleton.size());
     scales.resize(skeleton.size());
     
-    if (currentClipName.empty() || !HasClip(currentClipName)) {
+    if (currentClipName.IsNone() || !HasClip(currentClipName)) {
         // Return bind pose
         for (size_t i = 0; i < skeleton.size(); ++i) {
             positions[i] = skeleton[i].position;
@@ -323,15 +326,17 @@ void AnimationController::GetBoneTransforms(std::vector<Vector3>& positions, std
     
     const AnimationClip& currentClip = clips.at(currentClipName);
     
-    if (!nextClipName.empty() && blendDuration > 0.0f) {
+    if (!nextClipName.IsNone() && blendDuration > 0.0f) {
         // Blending between two animations
         const AnimationClip& nextClip = clips.at(nextClipName);
         
-        std::vector<Vector3> pos1, pos2, scale1, scale2;
-        std::vector<Quaternion> rot1, rot2;
+        // Per-call scratch poses live in the frame arena
+        size_t boneCount = skeleton.size();
+        FrameVector<Vector3> pos1(boneCount), pos2(boneCount), scale1(boneCount), scale2(boneCount);
+        FrameVector<Quaternion> rot1(boneCount), rot2(boneCount);
         
-        SampleClip(currentClip, currentTime, pos1, rot1, scale1);
-        SampleClip(nextClip, 0.0f, pos2, rot2, scale2);
+        SampleClip(currentClip, currentTime, pos1.data(), rot1.data(), scale1.data());
+        SampleClip(nextClip, 0.0f, pos2.data(), rot2.data(), scale2.data());
         
         float blend = Math::Clamp(blendTime / blendDuration, 0.0f, 1.0f);
         
@@ -341,11 +346,11 @@ void AnimationController::GetBoneTransforms(std::vector<Vector3>& positions, std
         }
     } else {
         // Single animation
-        SampleClip(currentClip, currentTime, positions, rotations, scales);
+        SampleClip(currentClip, currentTime, positions.data(), rotations.data(), scales.data());
     }
 }
 
-void AnimationController::AddEvent(const std::string& clipName, float time, const std::string& eventName) {
+void AnimationController::AddEvent(Name clipName, float time, Name eventName) {
     AnimationEvent event;
     event.clipName = clipName;
     event.time = time;
@@ -354,20 +359,13 @@ void AnimationController::AddEvent(const std::string& clipName, float time, cons
     events.push_back(event);
 }
 
-void AnimationController::SetEventCallback(void (*callback)(const std::string& eventName)) {
-    eventCallback = callback;
-}
-
-void AnimationController::SampleClip(const AnimationClip& clip, float time, std::vector<Vector3>& positions, 
-                                    std::vector<Quaternion>& rotations, std::vector<Vector3>& scales) const {
+void AnimationController::SampleClip(const AnimationClip& clip, float time, Vector3* positions, 
+                                    Quaternion* rotations, Vector3* scales) const {
+    // Output arrays must hold skeleton.size() elements
     if (skeleton.empty()) {
         return;
     }
     
-    positions.resize(skeleton.size());
-    rotations.resize(skeleton.size());
-    scales.resize(skeleton.size());
-    
     // Initialize with bind pose
     for (size_t i = 0; i < skeleton.size(); ++i) {
         positions[i] = skeleton[i].position;
@@ -422,14 +420,10 @@ void AnimationController::SampleClip(const AnimationClip& clip, float time, std:
 }
 
 void AnimationController::CheckEvents() {
-    if (!eventCallback) {
-        return;
-    }
-    
     for (auto& event : events) {
         if (event.clipName == currentClipName && !event.triggered) {
             if (currentTime >= event.time) {
-                eventCallback(event.eventName);
+                EventBus::Publish<AnimationNotifyEvent>(this, event.clipName, event.eventName);
                 event.triggered = true;
             }
         }
@@ -3,24 +3,38 @@
 
 namespace YUGA {
 
+    namespace {
+
+        template<typename T>
+        Handle<T> FindHandle(const std::unordered_map<Name, Handle<T>>& lookup, Name key) {
+            auto it = lookup.find(key);
+            if (it != lookup.end()) {
+                return it->second;
+            }
+            return {};
+        }
+
+    } // namespace
+
     AssetManager& AssetManager::Get() {
         static AssetManager instance;
         return instance;
     }
 
     // Model Management
-    std::shared_ptr<Model> AssetManager::LoadModel(const std::string& path) {
+    Ref<Model> AssetManager::LoadModel(const std::string& path) {
         // Check if already loaded
-        auto it = m_Models.find(path);
-        if (it != m_Models.end()) {
+        Name key(path);
+        ModelHandle handle = GetModelHandle(key);
+        if (handle) {
             LOG_INFO("Model already loaded: {}", path);
-            return it->second;
+            return m_Models.GetRef(handle);
         }
 
         // Load new model
-        auto model = std::make_shared<Model>();
+        auto model = CreateRef<Model>();
         if (model->LoadFromFile(path)) {
-            m_Models[path] = model;
+            m_ModelLookup[key] = m_Models.Add(model);
             LOG_INFO("Model cached: {}", path);
             return model;
         }
@@ -29,35 +43,39 @@ namespace YUGA {
         return nullptr;
     }
 
-    std::shared_ptr<Model> AssetManager::GetModel(const std::string& path) {
-        auto it = m_Models.find(path);
-        if (it != m_Models.end()) {
-            return it->second;
-        }
-        return nullptr;
+    Ref<Model> AssetManager::GetModel(Name path) {
+        return m_Models.GetRef(GetModelHandle(path));
     }
 
-    void AssetManager::UnloadModel(const std::string& path) {
-        auto it = m_Models.find(path);
-        if (it != m_Models.end()) {
-            it->second->Cleanup();
-            m_Models.erase(it);
+    ModelHandle AssetManager::GetModelHandle(Name path) const {
+        return FindHandle(m_ModelLookup, path);
+    }
+
+    void AssetManager::UnloadModel(Name path) {
+        auto it = m_ModelLookup.find(path);
+        if (it != m_ModelLookup.end()) {
+            if (Model* model = m_Models.Resolve(it->second)) {
+                model->Cleanup();
+            }
+            m_Models.Remove(it->second);
+            m_ModelLookup.erase(it);
             LOG_INFO("Model unloaded: {}", path);
         }
     }
 
     // Texture Management
-    std::shared_ptr<Texture> AssetManager::LoadTexture(const std::string& path, TextureType type) {
+    Ref<Texture> AssetManager::LoadTexture(const std::string& path, TextureType type) {
         // Check if already loaded
-        auto it = m_Textures.find(path);
-        if (it != m_Textures.end()) {
-            return it->second;
+        Name key(path);
+        TextureHandle handle = GetTextureHandle(key);
+        if (handle) {
+            return m_Textures.GetRef(handle);
         }
 
         // Load new texture
-        auto texture = std::make_shared<Texture>();
+        auto texture = CreateRef<Texture>();
         if (texture->LoadFromFile(path, type)) {
-            m_Textures[path] = texture;
+            m_TextureLookup[key] = m_Textures.Add(texture);
             return texture;
         }
 
@@ -65,79 +83,86 @@ namespace YUGA {
         return nullptr;
     }
 
-    std::shared_ptr<Texture> AssetManager::GetTexture(const std::string& path) {
-        auto it = m_Textures.find(path);
-        if (it != m_Textures.end()) {
-            return it->second;
-        }
-        return nullptr;
+    Ref<Texture> AssetManager::GetTexture(Name path) {
+        return m_Textures.GetRef(GetTextureHandle(path));
     }
 
-    void AssetManager::UnloadTexture(const std::string& path) {
-        auto it = m_Textures.find(path);
-        if (it != m_Textures.end()) {
-            it->second->Cleanup();
-            m_Textures.erase(it);
+    TextureHandle AssetManager::GetTextureHandle(Name path) const {
+        return FindHandle(m_TextureLookup, path);
+    }
+
+    void AssetManager::UnloadTexture(Name path) {
+        auto it = m_TextureLookup.find(path);
+        if (it != m_TextureLookup.end()) {
+            if (Texture* texture = m_Textures.Resolve(it->second)) {
+                texture->Cleanup();
+            }
+            m_Textures.Remove(it->second);
+            m_TextureLookup.erase(it);
             LOG_INFO("Texture unloaded: {}", path);
         }
     }
 
     // Material Management
-    std::shared_ptr<Material> AssetManager::CreateMaterial(const std::string& name) {
-        auto it = m_Materials.find(name);
-        if (it != m_Materials.end()) {
+    Ref<Material> AssetManager::CreateMaterial(const std::string& name) {
+        Name key(name);
+        MaterialHandle handle = GetMaterialHandle(key);
+        if (handle) {
             LOG_WARN("Material already exists: {}", name);
-            return it->second;
+            return m_Materials.GetRef(handle);
         }
 
-        auto material = std::make_shared<Material>(name);
-        m_Materials[name] = material;
+        auto material = CreateRef<Material>(name);
+        m_MaterialLookup[key] = m_Materials.Add(material);
         LOG_INFO("Material created: {}", name);
         return material;
     }
 
-    std::shared_ptr<Material> AssetManager::GetMaterial(const std::string& name) {
-        auto it = m_Materials.find(name);
-        if (it != m_Materials.end()) {
-            return it->second;
-        }
-        return nullptr;
+    Ref<Material> AssetManager::GetMaterial(Name name) {
+        return m_Materials.GetRef(GetMaterialHandle(name));
+    }
+
+    MaterialHandle AssetManager::GetMaterialHandle(Name name) const {
+        return FindHandle(m_MaterialLookup, name);
     }
 
-    void AssetManager::UnloadMaterial(const std::string& name) {
-        auto it = m_Materials.find(name);
-        if (it != m_Materials.end()) {
-            m_Materials.erase(it);
+    void AssetManager::UnloadMaterial(Name name) {
+        auto it = m_MaterialLookup.find(name);
+        if (it != m_MaterialLookup.end()) {
+            m_Materials.Remove(it->second);
+            m_MaterialLookup.erase(it);
             LOG_INFO("Material unloaded: {}", name);
         }
     }
 
     // Shader Management
-    std::shared_ptr<Shader> AssetManager::LoadShader(const std::string& name, const std::string& vertexPath, const std::string& fragmentPath) {
-        auto it = m_Shaders.find(name);
-        if (it != m_Shaders.end()) {
+    Ref<Shader> AssetManager::LoadShader(const std::string& name, const std::string& vertexPath, const std::string& fragmentPath) {
+        Name key(name);
+        ShaderHandle handle = GetShaderHandle(key);
+        if (handle) {
             LOG_INFO("Shader already loaded: {}", name);
-            return it->second;
+            return m_Shaders.GetRef(handle);
         }
 
-        auto shader = std::make_shared<Shader>(vertexPath, fragmentPath);
-        m_Shaders[name] = shader;
+        auto shader = CreateRef<Shader>(vertexPath, fragmentPath);
+        m_ShaderLookup[key] = m_Shaders.Add(shader);
         LOG_INFO("Shader loaded: {}", name);
         return shader;
     }
 
-    std::shared_ptr<Shader> AssetManager::GetShader(const std::string& name) {
-        auto it = m_Shaders.find(name);
-        if (it != m_Shaders.end()) {
-            return it->second;
-        }
-        return nullptr;
+    Ref<Shader> AssetManager::GetShader(Name name) {
+        return m_Shaders.GetRef(GetShaderHandle(name));
+    }
+
+    ShaderHandle AssetManager::GetShaderHandle(Name name) const {
+        return FindHandle(m_ShaderLookup, name);
     }
 
-    void AssetManager::UnloadShader(const std::string& name) {
-        auto it = m_Shaders.find(name);
-        if (it != m_Shaders.end()) {
-            m_Shaders.erase(it);
+    void AssetManager::UnloadShader(Name name) {
+        auto it = m_ShaderLookup.find(name);
+        if (it != m_ShaderLookup.end()) {
+            m_Shaders.Remove(it->second);
+            m_ShaderLookup.erase(it);
             LOG_INFO("Shader unloaded: {}", name);
         }
     }
@@ -146,60 +171,70 @@ namespace YUGA {
     void AssetManager::UnloadAll() {
         LOG_INFO("Unloading all assets...");
         
-        for (auto& [path, model] : m_Models) {
+        m_Models.ForEach([](ModelHandle, const Ref<Model>& model) {
             model->Cleanup();
-        }
-        m_Models.clear();
+        });
+        m_Models.Clear();
+        m_ModelLookup.clear();
 
-        for (auto& [path, texture] : m_Textures) {
+        m_Textures.ForEach([](TextureHandle, const Ref<Texture>& texture) {
             texture->Cleanup();
-        }
-        m_Textures.clear();
+        });
+        m_Textures.Clear();
+        m_TextureLookup.clear();
 
-        m_Materials.clear();
-        m_Shaders.clear();
+        m_Materials.Clear();
+        m_MaterialLookup.clear();
+        m_Shaders.Clear();
+        m_ShaderLookup.clear();
 
         LOG_INFO("All assets unloaded");
     }
 
     void AssetManager::UnloadUnused() {
         // Remove models with only 1 reference (only AssetManager holds it)
-        for (auto it = m_Models.begin(); it != m_Models.end();) {
-            if (it->second.use_count() == 1) {
+        for (auto it = m_ModelLookup.begin(); it != m_ModelLookup.end();) {
+            const Ref<Model>& model = m_Models.GetRef(it->second);
+            if (model.use_count() == 1) {
                 LOG_INFO("Unloading unused model: {}", it->first);
-                it->second->Cleanup();
-                it = m_Models.erase(it);
+                model->Cleanup();
+                m_Models.Remove(it->second);
+                it = m_ModelLookup.erase(it);
             } else {
                 ++it;
             }
         }
 
         // Remove textures with only 1 reference
-        for (auto it = m_Textures.begin(); it != m_Textures.end();) {
-            if (it->second.use_count() == 1) {
+        for (auto it = m_TextureLookup.begin(); it != m_TextureLookup.end();) {
+            const Ref<Texture>& texture = m_Textures.GetRef(it->second);
+            if (texture.use_count() == 1) {
                 LOG_INFO("Unloading unused texture: {}", it->first);
-                it->second->Cleanup();
-                it = m_Textures.erase(it);
+                texture->Cleanup();
+                m_Textures.Remove(it->second);
+                it = m_TextureLookup.erase(it);
             } else {
                 ++it;
             }
         }
 
         // Remove materials with only 1 reference
-        for (auto it = m_Materials.begin(); it != m_Materials.end();) {
-            if (it->second.use_count() == 1) {
+        for (auto it = m_MaterialLookup.begin(); it != m_MaterialLookup.end();) {
+            if (m_Materials.GetRef(it->second).use_count() == 1) {
                 LOG_INFO("Unloading unused material: {}", it->first);
-                it = m_Materials.erase(it);
+                m_Materials.Remove(it->second);
+                it = m_MaterialLookup.erase(it);
             } else {
                 ++it;
             }
         }
 
         // Remove shaders with only 1 reference
-        for (auto it = m_Shaders.begin(); it != m_Shaders.end();) {
-            if (it->second.use_count() == 1) {
+        for (auto it = m_ShaderLookup.begin(); it != m_ShaderLookup.end();) {
+            if (m_Shaders.GetRef(it->second).use_count() == 1) {
                 LOG_INFO("Unloading unused shader: {}", it->first);
-                it = m_Shaders.erase(it);
+                m_Shaders.Remove(it->second);
+                it = m_ShaderLookup.erase(it);
             } else {
                 ++it;
             }
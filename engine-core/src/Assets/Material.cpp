@@ -10,11 +10,11 @@ namespace YUGA {
     Material::~Material() {
     }
 
-    void Material::SetShader(std::shared_ptr<Shader> shader) {
+    void Material::SetShader(Ref<Shader> shader) {
         m_Shader = shader;
     }
 
-    void Material::SetTexture(TextureType type, std::shared_ptr<Texture> texture) {
+    void Material::SetTexture(TextureType type, Ref<Texture> texture) {
         // Remove existing texture of this type
         RemoveTexture(type);
         
@@ -63,21 +63,21 @@ namespace YUGA {
     void Material::ApplyProperties() {
         if (!m_Shader) return;
 
-        m_Shader->SetFloat3("u_Material.albedo", m_Properties.Albedo);
-        m_Shader->SetFloat("u_Material.metallic", m_Properties.Metallic);
-        m_Shader->SetFloat("u_Material.roughness", m_Properties.Roughness);
-        m_Shader->SetFloat("u_Material.ao", m_Properties.AO);
-        m_Shader->SetFloat3("u_Material.emissive", m_Properties.Emissive);
-        m_Shader->SetFloat("u_Material.emissiveStrength", m_Properties.EmissiveStrength);
-        m_Shader->SetFloat("u_Material.opacity", m_Properties.Opacity);
+        m_Shader->SetFloat3(YUGA_NAME("u_Material.albedo"), m_Properties.Albedo);
+        m_Shader->SetFloat(YUGA_NAME("u_Material.metallic"), m_Properties.Metallic);
+        m_Shader->SetFloat(YUGA_NAME("u_Material.roughness"), m_Properties.Roughness);
+        m_Shader->SetFloat(YUGA_NAME("u_Material.ao"), m_Properties.AO);
+        m_Shader->SetFloat3(YUGA_NAME("u_Material.emissive"), m_Properties.Emissive);
+        m_Shader->SetFloat(YUGA_NAME("u_Material.emissiveStrength"), m_Properties.EmissiveStrength);
+        m_Shader->SetFloat(YUGA_NAME("u_Material.opacity"), m_Properties.Opacity);
 
         // Set texture flags
-        m_Shader->SetInt("u_Material.hasAlbedoMap", HasTexture(TextureType::Diffuse) ? 1 : 0);
-        m_Shader->SetInt("u_Material.hasNormalMap", HasTexture(TextureType::Normal) ? 1 : 0);
-        m_Shader->SetInt("u_Material.hasMetallicMap", HasTexture(TextureType::Metallic) ? 1 : 0);
-        m_Shader->SetInt("u_Material.hasRoughnessMap", HasTexture(TextureType::Roughness) ? 1 : 0);
-        m_Shader->SetInt("u_Material.hasAOMap", HasTexture(TextureType::AO) ? 1 : 0);
-        m_Shader->SetInt("u_Material.hasEmissiveMap", HasTexture(TextureType::Emissive) ? 1 : 0);
+        m_Shader->SetInt(YUGA_NAME("u_Material.hasAlbedoMap"), HasTexture(TextureType::Diffuse) ? 1 : 0);
+        m_Shader->SetInt(YUGA_NAME("u_Material.hasNormalMap"), HasTexture(TextureType::Normal) ? 1 : 0);
+        m_Shader->SetInt(YUGA_NAME("u_Material.hasMetallicMap"), HasTexture(TextureType::Metallic) ? 1 : 0);
+        m_Shader->SetInt(YUGA_NAME("u_Material.hasRoughnessMap"), HasTexture(TextureType::Roughness) ? 1 : 0);
+        m_Shader->SetInt(YUGA_NAME("u_Material.hasAOMap"), HasTexture(TextureType::AO) ? 1 : 0);
+        m_Shader->SetInt(YUGA_NAME("u_Material.hasEmissiveMap"), HasTexture(TextureType::Emissive) ? 1 : 0);
     }
 
     bool Material::HasTexture(TextureType type) const {
@@ -87,7 +87,7 @@ namespace YUGA {
         return false;
     }
 
-    std::shared_ptr<Texture> Material::GetTexture(TextureType type) const {
+    Ref<Texture> Material::GetTexture(TextureType type) const {
         for (const auto& [texType, texture] : m_Textures) {
             if (texType == type) return texture;
         }
@@ -108,17 +108,17 @@ namespace YUGA {
         }
     }
 
-    const char* Material::GetTextureUniformName(TextureType type) const {
+    Name Material::GetTextureUniformName(TextureType type) const {
         switch (type) {
-            case TextureType::Diffuse:   return "u_AlbedoMap";
-            case TextureType::Normal:    return "u_NormalMap";
-            case TextureType::Metallic:  return "u_MetallicMap";
-            case TextureType::Roughness: return "u_RoughnessMap";
-            case TextureType::AO:        return "u_AOMap";
-            case TextureType::Emissive:  return "u_EmissiveMap";
-            case TextureType::Specular:  return "u_SpecularMap";
-            case TextureType::Height:    return "u_HeightMap";
-            default:                     return "u_Texture";
+            case TextureType::Diffuse:   return YUGA_NAME("u_AlbedoMap");
+            case TextureType::Normal:    return YUGA_NAME("u_NormalMap");
+            case TextureType::Metallic:  return YUGA_NAME("u_MetallicMap");
+            case TextureType::Roughness: return YUGA_NAME("u_RoughnessMap");
+            case TextureType::AO:        return YUGA_NAME("u_AOMap");
+            case TextureType::Emissive:  return YUGA_NAME("u_EmissiveMap");
+            case TextureType::Specular:  return YUGA_NAME("u_SpecularMap");
+            case TextureType::Height:    return YUGA_NAME("u_HeightMap");
+            default:                     return YUGA_NAME("u_Texture");
         }
     }
 
@@ -43,7 +43,7 @@ namespace YUGA {
         // Process materials first
         m_Materials.reserve(scene->mNumMaterials);
         for (unsigned int i = 0; i < scene->mNumMaterials; i++) {
-            auto material = std::make_shared<Material>("Material_" + std::to_string(i));
+            auto material = CreateRef<Material>("Material_" + std::to_string(i));
             LoadMaterialTextures(scene->mMaterials[i], scene, material);
             m_Materials.push_back(material);
         }
@@ -69,7 +69,7 @@ namespace YUGA {
         }
     }
 
-    std::shared_ptr<Mesh> Model::ProcessMesh(aiMesh* mesh, const aiScene* scene) {
+    Ref<Mesh> Model::ProcessMesh(aiMesh* mesh, const aiScene* scene) {
         std::vector<Vertex> vertices;
         std::vector<unsigned int> indices;
 
@@ -119,13 +119,13 @@ namespace YUGA {
             }
         }
 
-        auto resultMesh = std::make_shared<Mesh>(vertices, indices);
+        auto resultMesh = CreateRef<Mesh>(vertices, indices);
         resultMesh->MaterialIndex = mesh->mMaterialIndex;
 
         return resultMesh;
     }
 
-    void Model::LoadMaterialTextures(aiMaterial* mat, const aiScene* scene, std::shared_ptr<Material> material) {
+    void Model::LoadMaterialTextures(aiMaterial* mat, const aiScene* scene, Ref<Material> material) {
         auto& assetManager = AssetManager::Get();
 
         // Helper lambda to load texture
@@ -193,7 +193,7 @@ namespace YUGA {
         m_IsLoaded = false;
     }
 
-    void Model::SetMaterial(size_t meshIndex, std::shared_ptr<Material> material) {
+    void Model::SetMaterial(size_t meshIndex, Ref<Material> material) {
         if (meshIndex < m_Meshes.size()) {
             m_Meshes[meshIndex]->MaterialIndex = static_cast<unsigned int>(m_Materials.size());
             m_Materials.push_back(material);
@@ -6,7 +6,15 @@
 #include "Input/InputManager.h"
 #include "Physics/PhysicsWorld.h"
 #include "Audio/AudioEngine.h"
+#include "Scripting/ScriptEngine.h"
+#include "Assets/AssetManager.h"
+#include "Core/JobSystem.h"
+#include "Memory/FrameAllocator.h"
+#include "Memory/MemoryTracker.h"
+#include "Core/EventBus.h"
+#include <algorithm>
 #include <chrono>
+#include <fstream>
 
 namespace YUGA {
 
@@ -19,15 +27,24 @@ void Engine::Initialize(const EngineConfig& config) {
     YUGA_LOG_INFO("🚀 Initializing YUGA Engine v1.0.0");
     YUGA_LOG_INFO("━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━");
     
-    // Initialize subsystems
+    JobSystem::Initialize(config.workerThreads);
+    PhysicsWorld::InstallGlobalHooks();
+    
+    // Run() pumps the bus from here on, so events queue until its sync points
+    EventBus::SetDispatchLoopRunning(true);
+    
+    // Independent subsystems start in parallel; see RegisterSubsystems
     // m_Window = CreateScope<Window>(WindowProps(config.title, config.width, config.height, config.vsync));
-    m_Renderer = CreateScope<Renderer>();
-    // m_Physics = CreateScope<PhysicsWorld>();
-    // m_Audio = CreateScope<AudioEngine>();
     // m_Input = CreateScope<InputManager>();
     // m_SceneManager = CreateScope<SceneManager>();
+    RegisterSubsystems(config);
+    if (!m_Startup.Run()) {
+        YUGA_LOG_CRITICAL("Engine startup failed: invalid subsystem graph");
+        return;
+    }
+    m_StartupTracePath = config.startupTracePath;
     
-    YUGA_LOG_INFO("✓ Core systems initialized");
+    YUGA_LOG_INFO("✓ Core systems initialized in ", m_Startup.GetElapsedMs(), " ms");
     YUGA_LOG_INFO("✓ Window: ", config.width, "x", config.height);
     YUGA_LOG_INFO("✓ VSync: ", config.vsync ? "Enabled" : "Disabled");
     YUGA_LOG_INFO("✓ Renderer: OpenGL 4.6");
@@ -36,6 +53,88 @@ void Engine::Initialize(const EngineConfig& config) {
     m_Running = true;
 }
 
+void Engine::RegisterSubsystems(const EngineConfig& config) {
+    auto isLazy = [&config](Name name) {
+        return std::find(config.lazySubsystems.begin(), config.lazySubsystems.end(), name) != config.lazySubsystems.end();
+    };
+    
+    // Owns the GL context, so it stays on the main thread
+    m_Startup.Register({
+        .name = YUGA_NAME("Renderer"),
+        .initialize = [this] { m_Renderer = CreateScope<Renderer>(); },
+        .shutdown = [this] { m_Renderer.reset(); },
+        .mainThread = true,
+        .lazy = isLazy(YUGA_NAME("Renderer")),
+    });
+    
+    m_Startup.Register({
+        .name = YUGA_NAME("Physics"),
+        .initialize = [this, async = config.asyncPhysics, multithreaded = config.multithreadedPhysics,
+                       deterministic = config.deterministicPhysics] {
+            PhysicsWorldConfig physicsConfig;
+            physicsConfig.Multithreaded = multithreaded;
+            physicsConfig.Deterministic = deterministic;
+            m_Physics = CreateScope<PhysicsWorld>();
+            m_Physics->Initialize(physicsConfig);
+            if (async) {
+                m_Physics->SetMode(PhysicsMode::Asynchronous);
+            }
+        },
+        .shutdown = [this] { m_Physics.reset(); },
+        .lazy = isLazy(YUGA_NAME("Physics")),
+    });
+    
+    m_Startup.Register({
+        .name = YUGA_NAME("Audio"),
+        .initialize = [] { AudioEngine::Initialize(); },
+        .shutdown = [] { AudioEngine::Shutdown(); },
+        .lazy = isLazy(YUGA_NAME("Audio")),
+    });
+    
+    m_Startup.Register({
+        .name = YUGA_NAME("Scripting"),
+        .initialize = [] { ScriptEngine::Initialize(); },
+        .shutdown = [] { ScriptEngine::Shutdown(); },
+        .lazy = isLazy(YUGA_NAME("Scripting")),
+    });
+    
+    // GPU uploads need the renderer's context
+    std::vector<std::string> preloadModels = config.preloadModels;
+    m_Startup.Register({
+        .name = YUGA_NAME("AssetPreload"),
+        .dependencies = { YUGA_NAME("Renderer") },
+        .initialize = [preloadModels] {
+            for (const std::string& path : preloadModels) {
+                AssetManager::Get().LoadModel(path);
+            }
+        },
+        .shutdown = [] { AssetManager::Get().UnloadAll(); },
+        .mainThread = true,
+        .lazy = isLazy(YUGA_NAME("AssetPreload")),
+    });
+}
+
+PhysicsWorld* Engine::GetPhysics() {
+    m_Startup.EnsureInitialized(YUGA_NAME("Physics"));
+    return m_Physics.get();
+}
+
+void Engine::OnFirstFrame() {
+    m_FirstFrameDone = true;
+    
+    double firstFrameMs = m_Startup.GetElapsedMs();
+    m_Startup.LogTrace(firstFrameMs);
+    
+    if (!m_StartupTracePath.empty()) {
+        std::ofstream file(m_StartupTracePath);
+        if (file.is_open()) {
+            m_Startup.WriteTrace(file, firstFrameMs);
+        } else {
+            YUGA_LOG_ERROR("Failed to write startup trace: ", m_StartupTracePath);
+        }
+    }
+}
+
 void Engine::Run() {
     YUGA_LOG_INFO("🎮 Starting main game loop...");
     
@@ -44,6 +143,9 @@ void Engine::Run() {
     float fpsTimer = 0.0f;
     
     while (m_Running) {
+        // Release last frame's transient allocations on every thread
+        FrameArena::NextFrame();
+        
         // Calculate delta time
         auto currentTime = std::chrono::high_resolution_clock::now();
         m_DeltaTime = std::chrono::duration<float>(currentTime - lastTime).count();
@@ -62,6 +164,13 @@ void Engine::Run() {
         Update(m_DeltaTime);
         Render();
         
+        // Final sync point: deliver events before the frame arenas roll over
+        EventBus::Dispatch();
+        
+        if (!m_FirstFrameDone) {
+            OnFirstFrame();
+        }
+        
         // TODO: Check window close
         // if (m_Window->ShouldClose()) {
         //     m_Running = false;
@@ -78,11 +187,20 @@ void Engine::Run() {
 }
 
 void Engine::Update(float deltaTime) {
+    MemoryTracker::Update(deltaTime);
+    
     // TODO: Update subsystems
     // m_Input->Update();
-    // m_Physics->Step(deltaTime);
     // m_Audio->Update();
     // m_SceneManager->Update(deltaTime);
+    
+    // Publishes last frame's async step and starts the next one
+    if (m_Physics) {
+        m_Physics->Update(deltaTime);
+    }
+    
+    // Sync point: deliver events raised by this frame's simulation
+    EventBus::Dispatch();
 }
 
 void Engine::Render() {
@@ -100,14 +218,17 @@ void Engine::Render() {
 void Engine::Shutdown() {
     YUGA_LOG_INFO("🛑 Shutting down YUGA Engine...");
     
+    EventBus::SetDispatchLoopRunning(false);
+    EventBus::Clear();
+    
     // Cleanup subsystems
     m_SceneManager.reset();
     m_Input.reset();
-    m_Audio.reset();
-    m_Physics.reset();
-    m_Renderer.reset();
+    m_Startup.Shutdown();
     m_Window.reset();
     
+    JobSystem::Shutdown();
+    
     YUGA_LOG_INFO("✓ Engine shutdown complete");
 }
 
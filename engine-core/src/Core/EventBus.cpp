@@ -0,0 +1,254 @@
+#include "Core/EventBus.h"
+#include "Core/Core.h"
+#include "Core/Log.h"
+#include <algorithm>
+#include <mutex>
+#include <vector>
+
+namespace YUGA {
+
+struct EventBus::ThreadQueue {
+    std::atomic<EventNode*> head{ nullptr };
+    std::atomic<bool> inUse{ true };
+};
+
+namespace {
+
+struct Subscriber {
+    EventSubscriptionId id;
+    uint32_t typeId;
+    std::function<void(const void*)> handler;
+    bool active = true;
+};
+
+// Main-thread state
+std::vector<std::vector<Subscriber>> s_Subscribers; // Indexed by event type id
+std::vector<Subscriber> s_PendingSubscribers;
+EventSubscriptionId s_NextSubscriptionId = 1;
+bool s_Dispatching = false;
+bool s_NeedsCompaction = false;
+std::mutex s_QueueMutex;
+
+} // namespace
+
+std::vector<EventBus::ThreadQueue*>& EventBus::GetQueues() {
+    // Queues are never freed; a queue whose thread has exited is reused by
+    // the next new thread once it has been drained
+    static std::vector<ThreadQueue*>* queues = new std::vector<ThreadQueue*>();
+    return *queues;
+}
+
+EventBus::ThreadQueue& EventBus::GetThreadQueue() {
+    struct Owner {
+        ThreadQueue* queue = nullptr;
+        ~Owner() {
+            if (queue) queue->inUse.store(false, std::memory_order_release);
+        }
+    };
+    thread_local Owner owner;
+
+    if (!owner.queue) {
+        std::lock_guard<std::mutex> lock(s_QueueMutex);
+        for (ThreadQueue* queue : GetQueues()) {
+            if (!queue->inUse.load(std::memory_order_acquire) && !queue->head.load(std::memory_order_acquire)) {
+                queue->inUse.store(true, std::memory_order_relaxed);
+                owner.queue = queue;
+                break;
+            }
+        }
+        if (!owner.queue) {
+            owner.queue = new ThreadQueue();
+            GetQueues().push_back(owner.queue);
+        }
+    }
+    return *owner.queue;
+}
+
+void EventBus::Enqueue(EventNode* node) {
+    std::atomic<EventNode*>& head = GetThreadQueue().head;
+    node->next = head.load(std::memory_order_relaxed);
+    while (!head.compare_exchange_weak(node->next, node, std::memory_order_release, std::memory_order_relaxed)) {
+    }
+}
+
+EventBus::EventNode* EventBus::CollectQueuedEvents() {
+    std::vector<ThreadQueue*> queues;
+    {
+        std::lock_guard<std::mutex> lock(s_QueueMutex);
+        queues = GetQueues();
+    }
+
+    EventNode* batch = nullptr;
+    EventNode* batchTail = nullptr;
+
+    for (ThreadQueue* queue : queues) {
+        EventNode* list = queue->head.exchange(nullptr, std::memory_order_acquire);
+        if (!list) {
+            continue;
+        }
+
+        // Queues are LIFO stacks; reverse to restore publish order
+        EventNode* reversed = nullptr;
+        EventNode* tail = list;
+        while (list) {
+            EventNode* next = list->next;
+            list->next = reversed;
+            reversed = list;
+            list = next;
+        }
+
+        if (batchTail) {
+            batchTail->next = reversed;
+        } else {
+            batch = reversed;
+        }
+        batchTail = tail;
+    }
+
+    return batch;
+}
+
+size_t EventBus::DestroyEvents(EventNode* node) {
+    size_t count = 0;
+    while (node) {
+        EventNode* next = node->next;
+        if (node->destroy) {
+            node->destroy(node);
+        }
+        ++count;
+        node = next;
+    }
+    return count;
+}
+
+EventSubscriptionId EventBus::AddSubscriber(uint32_t typeId, Handler handler) {
+    Subscriber subscriber{ s_NextSubscriptionId++, typeId, std::move(handler), true };
+    EventSubscriptionId id = subscriber.id;
+
+    if (s_Dispatching) {
+        s_PendingSubscribers.push_back(std::move(subscriber));
+    } else {
+        if (typeId >= s_Subscribers.size()) {
+            s_Subscribers.resize(typeId + 1);
+        }
+        s_Subscribers[typeId].push_back(std::move(subscriber));
+    }
+    return id;
+}
+
+void EventBus::Unsubscribe(EventSubscriptionId id) {
+    auto pending = std::find_if(s_PendingSubscribers.begin(), s_PendingSubscribers.end(),
+        [id](const Subscriber& subscriber) { return subscriber.id == id; });
+    if (pending != s_PendingSubscribers.end()) {
+        s_PendingSubscribers.erase(pending);
+        return;
+    }
+
+    for (auto& subscribers : s_Subscribers) {
+        for (Subscriber& subscriber : subscribers) {
+            if (subscriber.id == id && subscriber.active) {
+                // Tombstone only: the vector may be mid-iteration (or this
+                // very handler may be running) if called from Dispatch()
+                subscriber.active = false;
+                s_NeedsCompaction = true;
+                if (!s_Dispatching) {
+                    ApplyPendingSubscriptions();
+                }
+                return;
+            }
+        }
+    }
+}
+
+void EventBus::ApplyPendingSubscriptions() {
+    if (s_NeedsCompaction) {
+        for (auto& subscribers : s_Subscribers) {
+            subscribers.erase(std::remove_if(subscribers.begin(), subscribers.end(),
+                [](const Subscriber& subscriber) { return !subscriber.active; }), subscribers.end());
+        }
+        s_NeedsCompaction = false;
+    }
+
+    for (Subscriber& subscriber : s_PendingSubscribers) {
+        if (subscriber.typeId >= s_Subscribers.size()) {
+            s_Subscribers.resize(subscriber.typeId + 1);
+        }
+        s_Subscribers[subscriber.typeId].push_back(std::move(subscriber));
+    }
+    s_PendingSubscribers.clear();
+}
+
+void EventBus::Deliver(uint32_t typeId, const void* payload) {
+    if (typeId >= s_Subscribers.size()) {
+        return;
+    }
+
+    // Index loop: handlers may tombstone entries but not resize the vector
+    std::vector<Subscriber>& subscribers = s_Subscribers[typeId];
+    for (size_t i = 0; i < subscribers.size(); ++i) {
+        if (subscribers[i].active) {
+            subscribers[i].handler(payload);
+        }
+    }
+}
+
+void EventBus::DeliverNow(uint32_t typeId, const void* payload) {
+    // Handlers may publish or subscribe in turn, as during Dispatch()
+    bool nested = s_Dispatching;
+    s_Dispatching = true;
+    Deliver(typeId, payload);
+    s_Dispatching = nested;
+    if (!nested) {
+        ApplyPendingSubscriptions();
+    }
+}
+
+void EventBus::ReportDroppedEvent() {
+    YUGA_LOG_WARN("EventBus dropped an event: out of memory for its node");
+}
+
+void EventBus::Dispatch() {
+    s_Dispatching = true;
+    size_t dispatched = 0;
+
+    int pass = 0;
+    for (; pass < MaxDispatchPasses; ++pass) {
+        EventNode* node = CollectQueuedEvents();
+        if (!node) {
+            break;
+        }
+
+        while (node) {
+            EventNode* next = node->next;
+
+            Deliver(node->typeId, node->payload);
+
+            if (node->destroy) {
+                node->destroy(node);
+            }
+            ++dispatched;
+            node = next;
+        }
+    }
+
+    // Whatever is still queued lives in this frame's arena
+    if (pass == MaxDispatchPasses) {
+        if (size_t dropped = DestroyEvents(CollectQueuedEvents())) {
+            YUGA_LOG_WARN("EventBus dropped ", dropped, " events still queued after ", MaxDispatchPasses, " dispatch passes");
+        }
+    }
+
+    s_Dispatching = false;
+    s_LastDispatchCount = dispatched;
+    ApplyPendingSubscriptions();
+}
+
+void EventBus::Clear() {
+    DestroyEvents(CollectQueuedEvents());
+
+    s_Subscribers.clear();
+    s_PendingSubscribers.clear();
+    s_NeedsCompaction = false;
+}
+
+} // namespace YUGA
@@ -0,0 +1,165 @@
+#include "Core/JobSystem.h"
+#include "Core/Core.h"
+#include "Core/Log.h"
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace YUGA {
+
+namespace {
+
+struct Job {
+    std::function<void()> function;
+    JobCounter* counter;
+};
+
+std::mutex s_QueueMutex;
+std::condition_variable s_QueueCondition;
+std::deque<Job> s_Queue;
+std::vector<std::thread> s_Workers;
+bool s_Running = false;
+
+thread_local uint32_t t_ThreadIndex = 0;
+
+void Execute(Job& job) {
+    job.function();
+    if (job.counter) {
+        job.counter->pending.fetch_sub(1, std::memory_order_acq_rel);
+    }
+}
+
+void WorkerLoop(uint32_t index) {
+    t_ThreadIndex = index;
+
+    while (true) {
+        Job job;
+        {
+            std::unique_lock<std::mutex> lock(s_QueueMutex);
+            s_QueueCondition.wait(lock, [] { return !s_Queue.empty() || !s_Running; });
+            if (s_Queue.empty()) {
+                return; // Shutting down and drained
+            }
+            job = std::move(s_Queue.front());
+            s_Queue.pop_front();
+        }
+        Execute(job);
+    }
+}
+
+} // namespace
+
+void JobSystem::Initialize(uint32_t workerCount) {
+    if (!s_Workers.empty()) {
+        return;
+    }
+
+    if (workerCount == 0) {
+        uint32_t hardwareThreads = std::thread::hardware_concurrency();
+        workerCount = hardwareThreads > 1 ? hardwareThreads - 1 : 1;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(s_QueueMutex);
+        s_Running = true;
+    }
+
+    s_Workers.reserve(workerCount);
+    for (uint32_t i = 0; i < workerCount; ++i) {
+        s_Workers.emplace_back(WorkerLoop, i + 1);
+    }
+
+    YUGA_LOG_INFO("Job system started with ", workerCount, " workers");
+}
+
+void JobSystem::Shutdown() {
+    {
+        std::lock_guard<std::mutex> lock(s_QueueMutex);
+        s_Running = false;
+    }
+    s_QueueCondition.notify_all();
+
+    for (std::thread& worker : s_Workers) {
+        worker.join();
+    }
+    s_Workers.clear();
+}
+
+bool JobSystem::IsInitialized() {
+    return !s_Workers.empty();
+}
+
+uint32_t JobSystem::GetWorkerCount() {
+    return static_cast<uint32_t>(s_Workers.size());
+}
+
+uint32_t JobSystem::GetThreadIndex() {
+    return t_ThreadIndex;
+}
+
+void JobSystem::Schedule(std::function<void()> job, JobCounter* counter) {
+    if (counter) {
+        counter->pending.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    Job entry{ std::move(job), counter };
+    if (!IsInitialized()) {
+        Execute(entry);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(s_QueueMutex);
+        s_Queue.push_back(std::move(entry));
+    }
+    s_QueueCondition.notify_one();
+}
+
+bool JobSystem::RunPendingJob() {
+    Job job;
+    {
+        std::lock_guard<std::mutex> lock(s_QueueMutex);
+        if (s_Queue.empty()) {
+            return false;
+        }
+        job = std::move(s_Queue.front());
+        s_Queue.pop_front();
+    }
+    Execute(job);
+    return true;
+}
+
+void JobSystem::Wait(JobCounter& counter) {
+    while (!counter.IsDone()) {
+        if (!RunPendingJob()) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+void JobSystem::ParallelFor(size_t count, size_t batchSize, const std::function<void(size_t begin, size_t end)>& body) {
+    if (count == 0) {
+        return;
+    }
+
+    batchSize = std::max<size_t>(batchSize, 1);
+    if (!IsInitialized() || count <= batchSize) {
+        body(0, count);
+        return;
+    }
+
+    // The caller takes the first batch itself
+    JobCounter counter;
+    for (size_t begin = batchSize; begin < count; begin += batchSize) {
+        size_t end = std::min(begin + batchSize, count);
+        Schedule([&body, begin, end] { body(begin, end); }, &counter);
+    }
+
+    body(0, batchSize);
+    Wait(counter);
+}
+
+} // namespace YUGA
@@ -0,0 +1,92 @@
+#include "Core/Name.h"
+#include "Core/Core.h"
+#include "Core/Log.h"
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace YUGA {
+
+namespace {
+
+struct NameTable {
+    std::shared_mutex mutex;
+    // Node-based map: stored strings never move, so views into them stay valid
+    std::unordered_map<uint64_t, std::string> strings;
+};
+
+NameTable& GetNameTable() {
+    // Intentionally leaked so Names used during static destruction still resolve
+    static NameTable* table = new NameTable();
+    return *table;
+}
+
+} // namespace
+
+Name::Name(std::string_view str) {
+    if (str.empty()) {
+        return;
+    }
+
+    m_Hash = HashName(str);
+    Intern(m_Hash, str);
+}
+
+void Name::Intern(uint64_t hash, std::string_view str) {
+    NameTable& table = GetNameTable();
+
+    {
+        std::shared_lock<std::shared_mutex> lock(table.mutex);
+        auto it = table.strings.find(hash);
+        if (it != table.strings.end()) {
+            if (it->second != str) {
+                YUGA_LOG_ERROR("Name hash collision: '", it->second, "' and '", str, "'");
+            }
+            return;
+        }
+    }
+
+    std::unique_lock<std::shared_mutex> lock(table.mutex);
+    table.strings.try_emplace(hash, str);
+}
+
+size_t Name::GetInternedCount() {
+    NameTable& table = GetNameTable();
+    std::shared_lock<std::shared_mutex> lock(table.mutex);
+    return table.strings.size();
+}
+
+std::string_view Name::GetString() const {
+    if (IsNone()) {
+        return {};
+    }
+
+    NameTable& table = GetNameTable();
+    std::shared_lock<std::shared_mutex> lock(table.mutex);
+    auto it = table.strings.find(m_Hash);
+    if (it != table.strings.end()) {
+        return it->second;
+    }
+    return {};
+}
+
+std::string Name::ToString() const {
+    if (IsNone()) {
+        return "None";
+    }
+
+    std::string_view str = GetString();
+    if (!str.empty()) {
+        return std::string(str);
+    }
+
+    // Never interned: show the raw hash
+    static const char digits[] = "0123456789abcdef";
+    std::string result = "#";
+    for (int shift = 60; shift >= 0; shift -= 4) {
+        result += digits[(m_Hash >> shift) & 0xF];
+    }
+    return result;
+}
+
+} // namespace YUGA
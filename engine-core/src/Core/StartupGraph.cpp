@@ -0,0 +1,275 @@
+#include "Core/StartupGraph.h"
+#include "Core/Core.h"
+#include "Core/JobSystem.h"
+#include "Core/Log.h"
+#include <iomanip>
+
+namespace YUGA {
+
+void StartupGraph::Register(SubsystemDesc desc) {
+    if (m_Lookup.count(desc.name)) {
+        YUGA_LOG_ERROR("Subsystem registered twice: ", desc.name);
+        return;
+    }
+
+    auto node = std::make_unique<Node>();
+    node->desc = std::move(desc);
+    m_Lookup[node->desc.name] = m_Nodes.size();
+    m_Nodes.push_back(std::move(node));
+}
+
+bool StartupGraph::Run() {
+    m_StartTime = std::chrono::steady_clock::now();
+    size_t count = m_Nodes.size();
+
+    // Resolve dependency names
+    for (size_t i = 0; i < count; ++i) {
+        Node& node = *m_Nodes[i];
+        node.dependencyIndices.clear();
+        node.dependents.clear();
+    }
+    for (size_t i = 0; i < count; ++i) {
+        Node& node = *m_Nodes[i];
+        for (Name dependency : node.desc.dependencies) {
+            auto it = m_Lookup.find(dependency);
+            if (it == m_Lookup.end()) {
+                YUGA_LOG_ERROR("Subsystem ", node.desc.name, " depends on unknown subsystem ", dependency);
+                return false;
+            }
+            node.dependencyIndices.push_back(it->second);
+            m_Nodes[it->second]->dependents.push_back(i);
+        }
+    }
+
+    // Reject cycles anywhere in the graph, lazy subsystems included
+    {
+        std::vector<int> inDegree(count);
+        std::vector<size_t> ready;
+        for (size_t i = 0; i < count; ++i) {
+            inDegree[i] = static_cast<int>(m_Nodes[i]->dependencyIndices.size());
+            if (inDegree[i] == 0) ready.push_back(i);
+        }
+        size_t visited = 0;
+        while (!ready.empty()) {
+            size_t index = ready.back();
+            ready.pop_back();
+            ++visited;
+            for (size_t dependent : m_Nodes[index]->dependents) {
+                if (--inDegree[dependent] == 0) ready.push_back(dependent);
+            }
+        }
+        if (visited != count) {
+            YUGA_LOG_ERROR("Subsystem dependency cycle detected");
+            return false;
+        }
+    }
+
+    // Eager set: non-lazy subsystems plus everything they depend on
+    m_Eager.assign(count, false);
+    std::vector<size_t> stack;
+    for (size_t i = 0; i < count; ++i) {
+        if (!m_Nodes[i]->desc.lazy) stack.push_back(i);
+    }
+    while (!stack.empty()) {
+        size_t index = stack.back();
+        stack.pop_back();
+        if (m_Eager[index]) continue;
+        m_Eager[index] = true;
+        for (size_t dependency : m_Nodes[index]->dependencyIndices) {
+            stack.push_back(dependency);
+        }
+    }
+
+    std::vector<size_t> roots;
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Remaining = 0;
+        for (size_t i = 0; i < count; ++i) {
+            if (!m_Eager[i]) continue;
+            Node& node = *m_Nodes[i];
+            node.pendingDependencies = 0;
+            for (size_t dependency : node.dependencyIndices) {
+                if (m_Eager[dependency]) ++node.pendingDependencies;
+            }
+            if (node.pendingDependencies == 0) roots.push_back(i);
+            ++m_Remaining;
+        }
+    }
+
+    for (size_t index : roots) {
+        Launch(index);
+    }
+
+    // Main thread: run main-thread subsystems as they become ready and help
+    // with queued jobs in between
+    while (true) {
+        size_t index = 0;
+        bool haveMainThreadWork = false;
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            if (!m_MainThreadQueue.empty()) {
+                index = m_MainThreadQueue.front();
+                m_MainThreadQueue.pop_front();
+                haveMainThreadWork = true;
+            } else if (m_Remaining == 0) {
+                break;
+            }
+        }
+
+        if (haveMainThreadWork) {
+            Initialize(index, false);
+            OnInitialized(index);
+        } else if (!JobSystem::RunPendingJob()) {
+            std::unique_lock<std::mutex> lock(m_Mutex);
+            m_Condition.wait_for(lock, std::chrono::milliseconds(1), [this] {
+                return !m_MainThreadQueue.empty() || m_Remaining == 0;
+            });
+        }
+    }
+
+    return true;
+}
+
+void StartupGraph::Launch(size_t index) {
+    if (m_Nodes[index]->desc.mainThread) {
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_MainThreadQueue.push_back(index);
+        }
+        m_Condition.notify_all();
+        return;
+    }
+
+    JobSystem::Schedule([this, index] {
+        Initialize(index, false);
+        OnInitialized(index);
+    });
+}
+
+void StartupGraph::Initialize(size_t index, bool lazy) {
+    Node& node = *m_Nodes[index];
+
+    std::call_once(node.once, [&] {
+        auto start = std::chrono::steady_clock::now();
+        if (node.desc.initialize) {
+            node.desc.initialize();
+        }
+        auto end = std::chrono::steady_clock::now();
+
+        SubsystemTrace trace;
+        trace.name = node.desc.name;
+        trace.startMs = std::chrono::duration<double, std::milli>(start - m_StartTime).count();
+        trace.durationMs = std::chrono::duration<double, std::milli>(end - start).count();
+        trace.threadIndex = JobSystem::GetThreadIndex();
+        trace.lazy = lazy;
+
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Trace.push_back(trace);
+        m_InitOrder.push_back(index);
+        node.initialized.store(true, std::memory_order_release);
+    });
+}
+
+void StartupGraph::OnInitialized(size_t index) {
+    std::vector<size_t> ready;
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        for (size_t dependent : m_Nodes[index]->dependents) {
+            if (m_Eager[dependent] && --m_Nodes[dependent]->pendingDependencies == 0) {
+                ready.push_back(dependent);
+            }
+        }
+        --m_Remaining;
+    }
+    m_Condition.notify_all();
+
+    for (size_t dependent : ready) {
+        Launch(dependent);
+    }
+}
+
+void StartupGraph::EnsureInitialized(Name name) {
+    auto it = m_Lookup.find(name);
+    if (it == m_Lookup.end()) {
+        YUGA_LOG_ERROR("Unknown subsystem: ", name);
+        return;
+    }
+
+    Node& node = *m_Nodes[it->second];
+    if (node.initialized.load(std::memory_order_acquire)) {
+        return;
+    }
+
+    for (Name dependency : node.desc.dependencies) {
+        EnsureInitialized(dependency);
+    }
+    Initialize(it->second, true);
+}
+
+bool StartupGraph::IsInitialized(Name name) const {
+    auto it = m_Lookup.find(name);
+    return it != m_Lookup.end() && m_Nodes[it->second]->initialized.load(std::memory_order_acquire);
+}
+
+void StartupGraph::Shutdown() {
+    std::vector<size_t> order;
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        order = m_InitOrder;
+    }
+
+    for (auto it = order.rbegin(); it != order.rend(); ++it) {
+        const SubsystemDesc& desc = m_Nodes[*it]->desc;
+        if (desc.shutdown) {
+            desc.shutdown();
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_Nodes.clear();
+    m_Lookup.clear();
+    m_InitOrder.clear();
+    m_MainThreadQueue.clear();
+    m_Eager.clear();
+}
+
+double StartupGraph::GetElapsedMs() const {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - m_StartTime).count();
+}
+
+std::vector<SubsystemTrace> StartupGraph::GetTrace() const {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return m_Trace;
+}
+
+void StartupGraph::LogTrace(double firstFrameMs) const {
+    std::vector<SubsystemTrace> trace = GetTrace();
+
+    YUGA_LOG_INFO("Startup trace (time to first frame: ", firstFrameMs, " ms)");
+    for (const SubsystemTrace& entry : trace) {
+        YUGA_LOG_INFO("  ", entry.name, ": start ", entry.startMs, " ms, took ", entry.durationMs, " ms on ",
+                      entry.threadIndex == 0 ? "main thread" : "worker " + std::to_string(entry.threadIndex),
+                      entry.lazy ? " (lazy)" : "");
+    }
+}
+
+void StartupGraph::WriteTrace(std::ostream& out, double firstFrameMs) const {
+    std::vector<SubsystemTrace> trace = GetTrace();
+
+    std::ios::fmtflags flags = out.flags();
+    out << std::fixed << std::setprecision(1);
+
+    out << "{\"traceEvents\": [\n";
+    for (const SubsystemTrace& entry : trace) {
+        out << "  {\"name\": \"" << entry.name << "\", \"cat\": \"" << (entry.lazy ? "lazy" : "startup") << "\", ";
+        out << "\"ph\": \"X\", \"pid\": 0, \"tid\": " << entry.threadIndex << ", ";
+        out << "\"ts\": " << entry.startMs * 1000.0 << ", \"dur\": " << entry.durationMs * 1000.0 << "},\n";
+    }
+    out << "  {\"name\": \"FirstFrame\", \"ph\": \"i\", \"s\": \"g\", \"pid\": 0, \"tid\": 0, ";
+    out << "\"ts\": " << firstFrameMs * 1000.0 << "}\n";
+    out << "]}\n";
+
+    out.flags(flags);
+}
+
+} // namespace YUGA
@@ -0,0 +1,56 @@
+#include "Math/Frustum.h"
+#include <cmath>
+
+namespace YUGA {
+
+Frustum Frustum::FromMatrix(const Matrix4& viewProjection) {
+    // Gribb-Hartmann: each plane is the last row plus or minus another row
+    auto row = [&](int r) {
+        return Vector4(viewProjection.At(r, 0), viewProjection.At(r, 1), viewProjection.At(r, 2), viewProjection.At(r, 3));
+    };
+    Vector4 x = row(0);
+    Vector4 y = row(1);
+    Vector4 z = row(2);
+    Vector4 w = row(3);
+    
+    Frustum frustum;
+    frustum.planes[Left] = w + x;
+    frustum.planes[Right] = w - x;
+    frustum.planes[Bottom] = w + y;
+    frustum.planes[Top] = w - y;
+    frustum.planes[Near] = w + z;
+    frustum.planes[Far] = w - z;
+    
+    // Normalized, so plane tests give true distances for spheres
+    for (Vector4& plane : frustum.planes) {
+        float length = std::sqrt(plane.x * plane.x + plane.y * plane.y + plane.z * plane.z);
+        if (length > 0.0f) {
+            plane /= length;
+        }
+    }
+    return frustum;
+}
+
+bool Frustum::IntersectsBox(const Vector3& min, const Vector3& max) const {
+    for (const Vector4& plane : planes) {
+        // The corner furthest along the plane normal
+        float x = plane.x >= 0.0f ? max.x : min.x;
+        float y = plane.y >= 0.0f ? max.y : min.y;
+        float z = plane.z >= 0.0f ? max.z : min.z;
+        if (plane.x * x + plane.y * y + plane.z * z + plane.w < 0.0f) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Frustum::IntersectsSphere(const Vector3& center, float radius) const {
+    for (const Vector4& plane : planes) {
+        if (plane.x * center.x + plane.y * center.y + plane.z * center.z + plane.w < -radius) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace YUGA
@@ -0,0 +1,72 @@
+#include "Math/Random.h"
+
+namespace YUGA {
+
+namespace {
+
+uint64_t SplitMix64(uint64_t& state) {
+    uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+} // namespace
+
+void Random::Seed(uint64_t seed) {
+    // SplitMix64 spreads even small consecutive seeds over the whole state
+    uint64_t state = seed;
+    for (uint32_t lane = 0; lane < Lanes; ++lane) {
+        uint64_t a = SplitMix64(state);
+        uint64_t b = SplitMix64(state);
+        s0[lane] = static_cast<uint32_t>(a);
+        s1[lane] = static_cast<uint32_t>(a >> 32);
+        s2[lane] = static_cast<uint32_t>(b);
+        s3[lane] = static_cast<uint32_t>(b >> 32) | 1u;  // Never all zero
+    }
+    bufferedIndex = Lanes;
+}
+
+Float8 Random::NextFloat8() {
+    UInt32x8 a = UInt32x8::Load(s0);
+    UInt32x8 b = UInt32x8::Load(s1);
+    UInt32x8 c = UInt32x8::Load(s2);
+    UInt32x8 d = UInt32x8::Load(s3);
+    
+    UInt32x8 result = a + d;
+    UInt32x8 t = b.ShiftLeft<9>();
+    c = c ^ a;
+    d = d ^ b;
+    b = b ^ c;
+    a = a ^ d;
+    c = c ^ t;
+    d = d.ShiftLeft<11>() | d.ShiftRight<21>();
+    
+    a.Store(s0);
+    b.Store(s1);
+    c.Store(s2);
+    d.Store(s3);
+    
+    // Top 24 bits, which a float holds exactly
+    return result.ShiftRight<8>().ToFloat8() * Float8::Broadcast(1.0f / 16777216.0f);
+}
+
+void Random::Fill(float* out, uint32_t count, float min, float max) {
+    Float8 offset = Float8::Broadcast(min);
+    Float8 scale = Float8::Broadcast(max - min);
+    
+    uint32_t i = 0;
+    for (; i + Lanes <= count; i += Lanes) {
+        (offset + NextFloat8() * scale).StoreUnaligned(out + i);
+    }
+    
+    if (i < count) {
+        float block[Lanes];
+        (offset + NextFloat8() * scale).StoreUnaligned(block);
+        for (uint32_t lane = 0; i < count; ++lane, ++i) {
+            out[i] = block[lane];
+        }
+    }
+}
+
+} // namespace YUGA
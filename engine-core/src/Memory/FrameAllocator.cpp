@@ -0,0 +1,161 @@
+#include "Memory/FrameAllocator.h"
+#include <algorithm>
+#include <mutex>
+
+namespace YUGA {
+
+namespace {
+
+constexpr size_t BlockAlignment = 64;
+
+size_t AlignUp(size_t value, size_t alignment) {
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+void* AlignedAlloc(size_t size, size_t alignment = BlockAlignment) {
+    return ::operator new(size, std::align_val_t(alignment), std::nothrow);
+}
+
+void AlignedFree(void* ptr, size_t alignment = BlockAlignment) {
+    ::operator delete(ptr, std::align_val_t(alignment));
+}
+
+} // namespace
+
+// LinearArena implementation
+LinearArena::LinearArena(size_t capacity) {
+    if (capacity > 0) {
+        m_Buffer = static_cast<uint8_t*>(AlignedAlloc(capacity));
+        m_Capacity = m_Buffer ? capacity : 0;
+    }
+}
+
+LinearArena::~LinearArena() {
+    for (const OverflowChunk& chunk : m_OverflowChunks) {
+        AlignedFree(chunk.memory, chunk.alignment);
+    }
+    if (m_Buffer) {
+        AlignedFree(m_Buffer);
+    }
+}
+
+void* LinearArena::Allocate(size_t size, size_t alignment) {
+    if (size == 0) {
+        size = 1;
+    }
+
+    if (m_Buffer) {
+        uintptr_t base = reinterpret_cast<uintptr_t>(m_Buffer);
+        size_t offset = AlignUp(base + m_Offset, alignment) - base;
+        if (offset + size <= m_Capacity) {
+            m_Offset = offset + size;
+            return m_Buffer + offset;
+        }
+    }
+
+    return AllocateOverflow(size, alignment);
+}
+
+void* LinearArena::AllocateOverflow(size_t size, size_t alignment) {
+    size_t chunkAlignment = std::max(alignment, BlockAlignment);
+    size_t chunkSize = AlignUp(size, chunkAlignment);
+    void* chunk = AlignedAlloc(chunkSize, chunkAlignment);
+    if (!chunk) {
+        return nullptr;
+    }
+
+    m_OverflowChunks.push_back({ chunk, chunkAlignment });
+    m_OverflowBytes += chunkSize;
+    return chunk;
+}
+
+void LinearArena::Reset() {
+    size_t used = GetUsed();
+    m_HighWaterMark = std::max(m_HighWaterMark, used);
+
+    if (!m_OverflowChunks.empty()) {
+        for (const OverflowChunk& chunk : m_OverflowChunks) {
+            AlignedFree(chunk.memory, chunk.alignment);
+        }
+        m_OverflowChunks.clear();
+        m_OverflowBytes = 0;
+
+        // Grow the primary block so the next frame fits without overflowing
+        size_t newCapacity = std::max(m_Capacity * 2, AlignUp(m_HighWaterMark + m_HighWaterMark / 4, BlockAlignment));
+        uint8_t* newBuffer = static_cast<uint8_t*>(AlignedAlloc(newCapacity));
+        if (newBuffer) {
+            if (m_Buffer) {
+                AlignedFree(m_Buffer);
+            }
+            m_Buffer = newBuffer;
+            m_Capacity = newCapacity;
+        }
+    }
+
+    m_Offset = 0;
+}
+
+// FrameArena implementation
+std::atomic<uint64_t> FrameArena::s_FrameIndex{ 0 };
+
+namespace {
+
+struct ThreadFrameArena {
+    LinearArena arena{ FrameArena::DefaultCapacity };
+    uint64_t frameIndex = 0;
+};
+
+// Arenas of exited threads are kept and handed to new threads instead of
+// being freed, so frame memory a thread hands off (e.g. queued events)
+// stays valid until the end of the frame even if the thread exits.
+std::mutex s_FreeArenaMutex;
+std::vector<ThreadFrameArena*>* s_FreeArenas = new std::vector<ThreadFrameArena*>();
+
+struct ThreadFrameArenaOwner {
+    ThreadFrameArena* arena = nullptr;
+
+    ~ThreadFrameArenaOwner() {
+        if (arena) {
+            std::lock_guard<std::mutex> lock(s_FreeArenaMutex);
+            s_FreeArenas->push_back(arena);
+        }
+    }
+};
+
+thread_local ThreadFrameArenaOwner t_FrameArena;
+
+ThreadFrameArena& AcquireThreadFrameArena() {
+    if (!t_FrameArena.arena) {
+        std::lock_guard<std::mutex> lock(s_FreeArenaMutex);
+        if (!s_FreeArenas->empty()) {
+            t_FrameArena.arena = s_FreeArenas->back();
+            s_FreeArenas->pop_back();
+        } else {
+            t_FrameArena.arena = new ThreadFrameArena();
+        }
+    }
+    return *t_FrameArena.arena;
+}
+
+} // namespace
+
+LinearArena& FrameArena::GetThreadArena() {
+    ThreadFrameArena& threadArena = AcquireThreadFrameArena();
+
+    uint64_t frame = GetFrameIndex();
+    if (threadArena.frameIndex != frame) {
+        threadArena.arena.Reset();
+        threadArena.frameIndex = frame;
+    }
+    return threadArena.arena;
+}
+
+void* FrameArena::Allocate(size_t size, size_t alignment) {
+    return GetThreadArena().Allocate(size, alignment);
+}
+
+void FrameArena::NextFrame() {
+    s_FrameIndex.fetch_add(1, std::memory_order_acq_rel);
+}
+
+} // namespace YUGA
@@ -0,0 +1,247 @@
+#include "Memory/MemoryTracker.h"
+#include "Core/Core.h"
+#include "Core/Log.h"
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <mutex>
+
+namespace YUGA {
+
+namespace {
+
+constexpr size_t TagCount = static_cast<size_t>(MemoryTag::Count);
+
+// Header placed in front of MemoryTracker::Allocate blocks
+constexpr size_t HeaderSize = alignof(std::max_align_t);
+
+struct alignas(64) TagCounters {
+    std::atomic<size_t> liveBytes{ 0 };
+    std::atomic<size_t> peakBytes{ 0 };
+    std::atomic<uint64_t> allocationCount{ 0 };
+    std::atomic<uint64_t> freeCount{ 0 };
+    std::atomic<size_t> softBudget{ 0 };
+    std::atomic<size_t> hardBudget{ 0 };
+    std::atomic<bool> softExceeded{ false };
+    std::atomic<bool> hardExceeded{ false };    // Only unrefused allocations get past it
+
+    // Rate sampling (main thread only)
+    uint64_t lastAllocationCount = 0;
+    float sampleTime = 0.0f;
+    float allocationsPerSecond = 0.0f;
+};
+
+std::array<TagCounters, TagCount> s_Counters;
+
+std::mutex s_CallbackMutex;
+MemoryTracker::BudgetCallback s_BudgetCallback;
+
+TagCounters& GetCounters(MemoryTag tag) {
+    return s_Counters[static_cast<size_t>(tag)];
+}
+
+void UpdatePeak(TagCounters& counters, size_t live) {
+    size_t peak = counters.peakBytes.load(std::memory_order_relaxed);
+    while (live > peak && !counters.peakBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+    }
+}
+
+void* AllocateBlock(MemoryTag tag, size_t size) {
+    uint8_t* block = static_cast<uint8_t*>(std::malloc(size + HeaderSize));
+    if (!block) {
+        MemoryTracker::RecordFree(tag, size);
+        return nullptr;
+    }
+
+    *reinterpret_cast<size_t*>(block) = size;
+    return block + HeaderSize;
+}
+
+} // namespace
+
+const char* GetMemoryTagName(MemoryTag tag) {
+    switch (tag) {
+        case MemoryTag::General:   return "General";
+        case MemoryTag::Physics:   return "Physics";
+        case MemoryTag::Assets:    return "Assets";
+        case MemoryTag::Animation: return "Animation";
+        case MemoryTag::Particles: return "Particles";
+        case MemoryTag::Scripting: return "Scripting";
+        case MemoryTag::Network:   return "Network";
+        case MemoryTag::Count:     break;
+    }
+    return "Unknown";
+}
+
+void* MemoryTracker::Allocate(MemoryTag tag, size_t size) {
+    if (!RecordAllocation(tag, size)) {
+        return nullptr;
+    }
+    return AllocateBlock(tag, size);
+}
+
+void* MemoryTracker::AllocateUnrefused(MemoryTag tag, size_t size) {
+    Track(tag, size, false);
+    return AllocateBlock(tag, size);
+}
+
+void MemoryTracker::Free(MemoryTag tag, void* ptr) {
+    if (!ptr) {
+        return;
+    }
+
+    uint8_t* block = static_cast<uint8_t*>(ptr) - HeaderSize;
+    RecordFree(tag, *reinterpret_cast<size_t*>(block));
+    std::free(block);
+}
+
+bool MemoryTracker::RecordAllocation(MemoryTag tag, size_t size) {
+    return Track(tag, size, true);
+}
+
+bool MemoryTracker::Track(MemoryTag tag, size_t size, bool refuseOverHardBudget) {
+    TagCounters& counters = GetCounters(tag);
+
+    size_t live = counters.liveBytes.fetch_add(size, std::memory_order_relaxed) + size;
+
+    size_t hard = counters.hardBudget.load(std::memory_order_relaxed);
+    if (hard > 0 && live > hard) {
+        if (refuseOverHardBudget) {
+            counters.liveBytes.fetch_sub(size, std::memory_order_relaxed);
+            NotifyBudget(tag, MemoryBudgetLevel::Hard, live - size, hard);
+            return false;
+        }
+        if (!counters.hardExceeded.exchange(true, std::memory_order_relaxed)) {
+            NotifyBudget(tag, MemoryBudgetLevel::Hard, live, hard);
+        }
+    }
+
+    counters.allocationCount.fetch_add(1, std::memory_order_relaxed);
+    UpdatePeak(counters, live);
+
+    size_t soft = counters.softBudget.load(std::memory_order_relaxed);
+    if (soft > 0 && live > soft && !counters.softExceeded.exchange(true, std::memory_order_relaxed)) {
+        NotifyBudget(tag, MemoryBudgetLevel::Soft, live, soft);
+    }
+
+    return true;
+}
+
+void MemoryTracker::RecordFree(MemoryTag tag, size_t size) {
+    TagCounters& counters = GetCounters(tag);
+
+    size_t live = counters.liveBytes.fetch_sub(size, std::memory_order_relaxed) - size;
+    counters.freeCount.fetch_add(1, std::memory_order_relaxed);
+
+    // Re-arm the budgets once usage drops back under them
+    size_t soft = counters.softBudget.load(std::memory_order_relaxed);
+    if (soft > 0 && live <= soft) {
+        counters.softExceeded.store(false, std::memory_order_relaxed);
+    }
+    size_t hard = counters.hardBudget.load(std::memory_order_relaxed);
+    if (hard > 0 && live <= hard) {
+        counters.hardExceeded.store(false, std::memory_order_relaxed);
+    }
+}
+
+void MemoryTracker::SetBudget(MemoryTag tag, size_t softBytes, size_t hardBytes) {
+    TagCounters& counters = GetCounters(tag);
+    counters.softBudget.store(softBytes, std::memory_order_relaxed);
+    counters.hardBudget.store(hardBytes, std::memory_order_relaxed);
+    counters.softExceeded.store(false, std::memory_order_relaxed);
+    counters.hardExceeded.store(false, std::memory_order_relaxed);
+}
+
+void MemoryTracker::SetBudgetCallback(BudgetCallback callback) {
+    std::lock_guard<std::mutex> lock(s_CallbackMutex);
+    s_BudgetCallback = std::move(callback);
+}
+
+void MemoryTracker::NotifyBudget(MemoryTag tag, MemoryBudgetLevel level, size_t liveBytes, size_t budget) {
+    BudgetCallback callback;
+    {
+        std::lock_guard<std::mutex> lock(s_CallbackMutex);
+        callback = s_BudgetCallback;
+    }
+
+    if (callback) {
+        callback(tag, level, liveBytes, budget);
+    } else if (level == MemoryBudgetLevel::Hard) {
+        YUGA_LOG_ERROR("Memory budget exceeded for ", GetMemoryTagName(tag), ": ", liveBytes, " / ", budget, " bytes");
+    } else {
+        YUGA_LOG_WARN("Memory soft budget exceeded for ", GetMemoryTagName(tag), ": ", liveBytes, " / ", budget, " bytes");
+    }
+}
+
+void MemoryTracker::Update(float deltaTime) {
+    for (TagCounters& counters : s_Counters) {
+        counters.sampleTime += deltaTime;
+        if (counters.sampleTime >= 1.0f) {
+            uint64_t count = counters.allocationCount.load(std::memory_order_relaxed);
+            counters.allocationsPerSecond = (count - counters.lastAllocationCount) / counters.sampleTime;
+            counters.lastAllocationCount = count;
+            counters.sampleTime = 0.0f;
+        }
+    }
+}
+
+MemoryTagStats MemoryTracker::GetStats(MemoryTag tag) {
+    const TagCounters& counters = GetCounters(tag);
+
+    MemoryTagStats stats;
+    stats.liveBytes = counters.liveBytes.load(std::memory_order_relaxed);
+    stats.peakBytes = counters.peakBytes.load(std::memory_order_relaxed);
+    stats.allocationCount = counters.allocationCount.load(std::memory_order_relaxed);
+    stats.freeCount = counters.freeCount.load(std::memory_order_relaxed);
+    stats.allocationsPerSecond = counters.allocationsPerSecond;
+    stats.softBudget = counters.softBudget.load(std::memory_order_relaxed);
+    stats.hardBudget = counters.hardBudget.load(std::memory_order_relaxed);
+    return stats;
+}
+
+size_t MemoryTracker::GetTotalLiveBytes() {
+    size_t total = 0;
+    for (const TagCounters& counters : s_Counters) {
+        total += counters.liveBytes.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+void MemoryTracker::WriteReport(std::ostream& out) {
+    out << "{\n";
+    out << "  \"totalLiveBytes\": " << GetTotalLiveBytes() << ",\n";
+    out << "  \"tags\": [\n";
+
+    for (size_t i = 0; i < TagCount; ++i) {
+        MemoryTag tag = static_cast<MemoryTag>(i);
+        MemoryTagStats stats = GetStats(tag);
+
+        out << "    {";
+        out << "\"name\": \"" << GetMemoryTagName(tag) << "\", ";
+        out << "\"liveBytes\": " << stats.liveBytes << ", ";
+        out << "\"peakBytes\": " << stats.peakBytes << ", ";
+        out << "\"allocations\": " << stats.allocationCount << ", ";
+        out << "\"frees\": " << stats.freeCount << ", ";
+        out << "\"allocationsPerSecond\": " << stats.allocationsPerSecond << ", ";
+        out << "\"softBudget\": " << stats.softBudget << ", ";
+        out << "\"hardBudget\": " << stats.hardBudget;
+        out << "}" << (i + 1 < TagCount ? "," : "") << "\n";
+    }
+
+    out << "  ]\n";
+    out << "}\n";
+}
+
+bool MemoryTracker::DumpReport(const std::string& filepath) {
+    std::ofstream file(filepath);
+    if (!file.is_open()) {
+        YUGA_LOG_ERROR("Failed to write memory report: ", filepath);
+        return false;
+    }
+
+    WriteReport(file);
+    return true;
+}
+
+} // namespace YUGA
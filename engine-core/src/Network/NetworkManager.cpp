@@ -1,5 +1,6 @@
 #include "Network/NetworkManager.h"
 #include "Core/Log.h"
+#include "Core/EventBus.h"
 #include <cstring>
 
 namespace YUGA {
@@ -142,11 +143,11 @@ void NetworkManager::SendToAllExcept(uint32_t excludeId, const NetworkMessage& m
     }
 }
 
-void NetworkManager::RegisterRPC(const std::string& name, std::function<void(uint32_t, const std::vector<uint8_t>&)> callback) {
+void NetworkManager::RegisterRPC(Name name, std::function<void(uint32_t, const std::vector<uint8_t>&)> callback) {
     rpcCallbacks[name] = callback;
 }
 
-void NetworkManager::CallRPC(const std::string& name, const std::vector<uint8_t>& data) {
+void NetworkManager::CallRPC(Name name, const std::vector<uint8_t>& data) {
     if (mode == NetworkMode::Server) {
         CallRPCOnAll(name, data);
     } else {
@@ -154,29 +155,33 @@ void NetworkManager::CallRPC(const std::string& name, const std::vector<uint8_t>
     }
 }
 
-void NetworkManager::CallRPCOnServer(const std::string& name, const std::vector<uint8_t>& data) {
-    NetworkMessage msg;
-    msg.type = MessageType::RPC;
-    msg.data = data;
-    // Prepend RPC name to data
-    SendToServer(msg);
+void NetworkManager::CallRPCOnServer(Name name, const std::vector<uint8_t>& data) {
+    SendToServer(BuildRPCMessage(name, data));
 }
 
-void NetworkManager::CallRPCOnClient(uint32_t clientId, const std::string& name, const std::vector<uint8_t>& data) {
-    NetworkMessage msg;
-    msg.type = MessageType::RPC;
-    msg.data = data;
-    SendToClient(clientId, msg);
+void NetworkManager::CallRPCOnClient(uint32_t clientId, Name name, const std::vector<uint8_t>& data) {
+    SendToClient(clientId, BuildRPCMessage(name, data));
 }
 
-void NetworkManager::CallRPCOnAll(const std::string& name, const std::vector<uint8_t>& data) {
+void NetworkManager::CallRPCOnAll(Name name, const std::vector<uint8_t>& data) {
+    SendToAll(BuildRPCMessage(name, data));
+}
+
+NetworkMessage NetworkManager::BuildRPCMessage(Name name, const std::vector<uint8_t>& data) const {
+    // Prepend the 8-byte RPC name hash to data
+    uint64_t hash = name.GetHash();
+    
     NetworkMessage msg;
     msg.type = MessageType::RPC;
-    msg.data = data;
-    SendToAll(msg);
+    msg.data.resize(sizeof(hash) + data.size());
+    std::memcpy(msg.data.data(), &hash, sizeof(hash));
+    if (!data.empty()) {
+        std::memcpy(msg.data.data() + sizeof(hash), data.data(), data.size());
+    }
+    return msg;
 }
 
-void NetworkManager::RegisterSyncVar(const std::string& name, void* variable, size_t size) {
+void NetworkManager::RegisterSyncVar(Name name, void* variable, size_t size) {
     SyncVar syncVar;
     syncVar.variable = variable;
     syncVar.size = size;
@@ -186,7 +191,7 @@ void NetworkManager::RegisterSyncVar(const std::string& name, void* variable, si
     syncVars[name] = syncVar;
 }
 
-void NetworkManager::SyncToServer(const std::string& name) {
+void NetworkManager::SyncToServer(Name name) {
     auto it = syncVars.find(name);
     if (it == syncVars.end()) {
         return;
@@ -208,7 +213,7 @@ void NetworkManager::SyncToServer(const std::string& name) {
     }
 }
 
-void NetworkManager::SyncToClients(const std::string& name) {
+void NetworkManager::SyncToClients(Name name) {
     auto it = syncVars.find(name);
     if (it == syncVars.end()) {
         return;
@@ -241,29 +246,38 @@ void NetworkManager::ProcessMessages() {
 void NetworkManager::HandleMessage(const NetworkMessage& message) {
     switch (message.type) {
         case MessageType::Connect:
-            if (mode == NetworkMode::Server && onClientConnected) {
-                onClientConnected(message.clientId);
+            if (mode == NetworkMode::Server) {
+                EventBus::Publish<ClientConnectedEvent>(message.clientId);
             }
             break;
             
         case MessageType::Disconnect:
-            if (mode == NetworkMode::Server && onClientDisconnected) {
-                onClientDisconnected(message.clientId);
+            if (mode == NetworkMode::Server) {
+                EventBus::Publish<ClientDisconnectedEvent>(message.clientId);
             }
             break;
             
-        case MessageType::RPC:
-            // TODO: Parse RPC name and call callback
+        case MessageType::RPC: {
+            uint64_t hash = 0;
+            if (message.data.size() < sizeof(hash)) {
+                break;
+            }
+            std::memcpy(&hash, message.data.data(), sizeof(hash));
+            
+            auto it = rpcCallbacks.find(Name::FromHash(hash));
+            if (it != rpcCallbacks.end() && it->second) {
+                std::vector<uint8_t> args(message.data.begin() + sizeof(hash), message.data.end());
+                it->second(message.clientId, args);
+            }
             break;
+        }
             
         case MessageType::StateSync:
             // TODO: Update synced variables
             break;
             
         default:
-            if (onMessageReceived) {
-                onMessageReceived(message);
-            }
+            EventBus::Publish<NetworkMessageEvent>(message);
             break;
     }
 }
@@ -0,0 +1,53 @@
+#include "Physics/CollisionMesh.h"
+#include "Assets/Model.h"
+#include "Core/Name.h"
+#include <string_view>
+
+namespace YUGA {
+    
+    CollisionMesh CollisionMesh::FromMeshes(const std::vector<const Mesh*>& meshes) {
+        CollisionMesh result;
+        
+        size_t vertexCount = 0;
+        size_t indexCount = 0;
+        for (const Mesh* mesh : meshes) {
+            vertexCount += mesh->Vertices.size();
+            indexCount += mesh->Indices.size() - mesh->Indices.size() % 3;
+        }
+        result.Positions.reserve(vertexCount * 3);
+        result.Indices.reserve(indexCount);
+        
+        for (const Mesh* mesh : meshes) {
+            int baseVertex = static_cast<int>(result.GetVertexCount());
+            for (const Vertex& vertex : mesh->Vertices) {
+                result.Positions.push_back(vertex.Position.x);
+                result.Positions.push_back(vertex.Position.y);
+                result.Positions.push_back(vertex.Position.z);
+            }
+            
+            size_t meshIndexCount = mesh->Indices.size() - mesh->Indices.size() % 3;
+            for (size_t i = 0; i < meshIndexCount; ++i) {
+                result.Indices.push_back(baseVertex + static_cast<int>(mesh->Indices[i]));
+            }
+        }
+        
+        // Hash positions, then indices; combined so neither alone can collide
+        std::string_view positions(reinterpret_cast<const char*>(result.Positions.data()),
+                                   result.Positions.size() * sizeof(float));
+        std::string_view indices(reinterpret_cast<const char*>(result.Indices.data()),
+                                 result.Indices.size() * sizeof(int));
+        result.ContentHash = HashName(positions) * 31 + HashName(indices);
+        return result;
+    }
+    
+    CollisionMesh CollisionMesh::FromModel(const Model& model) {
+        std::vector<const Mesh*> meshes;
+        for (const Ref<Mesh>& mesh : model.GetMeshes()) {
+            if (mesh) {
+                meshes.push_back(mesh.get());
+            }
+        }
+        return FromMeshes(meshes);
+    }
+    
+} // namespace YUGA
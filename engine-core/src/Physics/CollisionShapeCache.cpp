@@ -0,0 +1,144 @@
+#include "Physics/CollisionShapeCache.h"
+#include "Core/Log.h"
+#include <algorithm>
+#include <cstring>
+
+namespace YUGA {
+    
+    namespace {
+        
+        size_t HashCombine(size_t seed, size_t value) {
+            return seed ^ (value + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2));
+        }
+        
+        size_t HashFloat(float value) {
+            uint32_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            return bits;
+        }
+        
+    } // namespace
+    
+    size_t CollisionShapeKeyHash::operator()(const CollisionShapeKey& key) const noexcept {
+        size_t hash = static_cast<size_t>(key.Type);
+        hash = HashCombine(hash, static_cast<size_t>(key.MeshId));
+        hash = HashCombine(hash, HashFloat(key.Size.x));
+        hash = HashCombine(hash, HashFloat(key.Size.y));
+        hash = HashCombine(hash, HashFloat(key.Size.z));
+        return hash;
+    }
+    
+    SharedCollisionShape::SharedCollisionShape(const CollisionShapeKey& key, std::unique_ptr<btCollisionShape> shape,
+                                               Ref<SharedCollisionShape> wrapped)
+        : m_Key(key), m_Shape(std::move(shape)), m_Wrapped(std::move(wrapped)) {
+    }
+    
+    SharedCollisionShape::~SharedCollisionShape() {
+        CollisionShapeCache::Get().Remove(this);
+        
+        // The wrapper references the wrapped shape: destroy it first
+        m_Shape.reset();
+        m_Wrapped.reset();
+    }
+    
+    CollisionShapeCache& CollisionShapeCache::Get() {
+        // Intentionally leaked so shapes released during static destruction can unregister
+        static CollisionShapeCache* instance = new CollisionShapeCache();
+        return *instance;
+    }
+    
+    CollisionShapeRef CollisionShapeCache::GetPrimitive(CollisionShape type, const Vector3& size) {
+        CollisionShapeKey key{ type, size, 0 };
+        if (CollisionShapeRef shape = Find(key)) {
+            return shape;
+        }
+        
+        std::unique_ptr<btCollisionShape> shape;
+        switch (type) {
+            case CollisionShape::Box:
+                shape = std::make_unique<btBoxShape>(btVector3(size.x * 0.5f, size.y * 0.5f, size.z * 0.5f));
+                break;
+            case CollisionShape::Sphere:
+                shape = std::make_unique<btSphereShape>(size.x * 0.5f);
+                break;
+            case CollisionShape::Capsule:
+                shape = std::make_unique<btCapsuleShape>(size.x * 0.5f, size.y);
+                break;
+            case CollisionShape::Mesh:
+            case CollisionShape::ConvexMesh:
+            case CollisionShape::Heightfield:
+                // Mesh shapes need mesh data, see GetMesh()
+                shape = std::make_unique<btBoxShape>(btVector3(size.x * 0.5f, size.y * 0.5f, size.z * 0.5f));
+                Log::Warn("Mesh collision shape requested without mesh data, using box");
+                break;
+        }
+        
+        return Insert(key, std::move(shape));
+    }
+    
+    CollisionShapeRef CollisionShapeCache::GetMesh(CollisionShape type, uint64_t meshId, const ShapeFactory& factory,
+                                                   const Vector3& size) {
+        CollisionShapeKey key{ type, size, meshId };
+        if (CollisionShapeRef shape = Find(key)) {
+            return shape;
+        }
+        
+        std::unique_ptr<btCollisionShape> shape = factory();
+        if (!shape) {
+            return nullptr;
+        }
+        return Insert(key, std::move(shape));
+    }
+    
+    CollisionShapeRef CollisionShapeCache::GetScaled(const CollisionShapeRef& shape, const Vector3& scale) {
+        if (!shape || (scale.x == 1.0f && scale.y == 1.0f && scale.z == 1.0f)) {
+            return shape;
+        }
+        
+        CollisionShapeKey key = shape->GetKey();
+        key.Size = key.Size * scale;
+        if (CollisionShapeRef scaled = Find(key)) {
+            return scaled;
+        }
+        
+        btCollisionShape* base = shape->GetShape();
+        std::unique_ptr<btCollisionShape> wrapper;
+        if (base->getShapeType() == TRIANGLE_MESH_SHAPE_PROXYTYPE) {
+            wrapper = std::make_unique<btScaledBvhTriangleMeshShape>(
+                static_cast<btBvhTriangleMeshShape*>(base), btVector3(scale.x, scale.y, scale.z));
+        } else if (base->isConvex() && scale.x == scale.y && scale.y == scale.z) {
+            wrapper = std::make_unique<btUniformScalingShape>(static_cast<btConvexShape*>(base), scale.x);
+        } else {
+            // Bullet has no non-uniform wrapper for these: the shape would have to be rebuilt
+            Log::Warn("Collision shape cannot be scaled non-uniformly, using unscaled shape");
+            return shape;
+        }
+        
+        return Insert(key, std::move(wrapper), shape);
+    }
+    
+    CollisionShapeRef CollisionShapeCache::Find(const CollisionShapeKey& key) const {
+        auto it = m_Shapes.find(key);
+        if (it == m_Shapes.end()) {
+            return nullptr;
+        }
+        return CollisionShapeRef(it->second);
+    }
+    
+    CollisionShapeRef CollisionShapeCache::Insert(const CollisionShapeKey& key, std::unique_ptr<btCollisionShape> shape,
+                                                  CollisionShapeRef wrapped) {
+        CollisionShapeRef shared = CreateRef<SharedCollisionShape>(key, std::move(shape), std::move(wrapped));
+        if (shared) {
+            m_Shapes[key] = shared.get();
+        }
+        return shared;
+    }
+    
+    void CollisionShapeCache::Remove(const SharedCollisionShape* shape) {
+        auto it = m_Shapes.find(shape->GetKey());
+        if (it != m_Shapes.end() && it->second == shape) {
+            m_Shapes.erase(it);
+        }
+    }
+    
+} // namespace YUGA
@@ -0,0 +1,471 @@
+#include "Physics/ConvexDecomposition.h"
+#include "Assets/Model.h"
+#include "Core/JobSystem.h"
+#include "Core/Log.h"
+#include <LinearMath/btConvexHullComputer.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+namespace YUGA {
+    
+    namespace {
+        
+        constexpr uint32_t HullCacheMagic = 0x4c554859;   // "YHUL"
+        constexpr uint32_t HullCacheVersion = 1;
+        
+        struct HullCacheHeader {
+            uint32_t Magic;
+            uint32_t Version;
+            uint32_t HullCount;
+            uint32_t Reserved;
+            uint64_t ContentHash;
+            uint64_t SettingsHash;
+        };
+        
+        struct Part {
+            std::vector<uint32_t> Triangles;
+            float HullVolume = 0.0f;
+            
+            // Best split, valid once Evaluated
+            bool Evaluated = false;
+            float BestGain = 0.0f;
+            int SplitAxis = 0;
+            float SplitPosition = 0.0f;
+        };
+        
+        float Centroid(const CollisionMesh& mesh, uint32_t triangle, int axis) {
+            const int* indices = &mesh.Indices[triangle * 3];
+            return (mesh.Positions[indices[0] * 3 + axis] +
+                    mesh.Positions[indices[1] * 3 + axis] +
+                    mesh.Positions[indices[2] * 3 + axis]) / 3.0f;
+        }
+        
+        // Unique vertex positions referenced by the triangles
+        std::vector<float> GatherPoints(const CollisionMesh& mesh, const std::vector<uint32_t>& triangles) {
+            std::vector<int> vertices;
+            vertices.reserve(triangles.size() * 3);
+            for (uint32_t triangle : triangles) {
+                for (int corner = 0; corner < 3; ++corner) {
+                    vertices.push_back(mesh.Indices[triangle * 3 + corner]);
+                }
+            }
+            std::sort(vertices.begin(), vertices.end());
+            vertices.erase(std::unique(vertices.begin(), vertices.end()), vertices.end());
+            
+            std::vector<float> points;
+            points.reserve(vertices.size() * 3);
+            for (int vertex : vertices) {
+                points.insert(points.end(), &mesh.Positions[vertex * 3], &mesh.Positions[vertex * 3] + 3);
+            }
+            return points;
+        }
+        
+        struct HullMass {
+            float Volume = 0.0f;
+            btVector3 Centroid{ 0, 0, 0 };
+        };
+        
+        HullMass ComputeHullMass(const btConvexHullComputer& hull) {
+            HullMass mass;
+            float signedVolume = 0.0f;
+            btVector3 moment(0, 0, 0);
+            for (int face = 0; face < hull.faces.size(); ++face) {
+                const btConvexHullComputer::Edge* first = &hull.edges[hull.faces[face]];
+                const btVector3& origin = hull.vertices[first->getSourceVertex()];
+                
+                // Fan the face polygon around its first vertex; each triangle
+                // and the coordinate origin form a signed tetrahedron
+                const btConvexHullComputer::Edge* edge = first->getNextEdgeOfFace();
+                while (edge->getTargetVertex() != first->getSourceVertex()) {
+                    const btVector3& a = hull.vertices[edge->getSourceVertex()];
+                    const btVector3& b = hull.vertices[edge->getTargetVertex()];
+                    float volume = origin.dot(a.cross(b));
+                    signedVolume += volume;
+                    moment += (origin + a + b) * volume;
+                    edge = edge->getNextEdgeOfFace();
+                }
+            }
+            mass.Volume = std::abs(signedVolume) / 6.0f;
+            if (signedVolume != 0.0f) {
+                mass.Centroid = moment / (4.0f * signedVolume);
+            }
+            return mass;
+        }
+        
+        float ComputeHullVolume(const btConvexHullComputer& hull) {
+            return ComputeHullMass(hull).Volume;
+        }
+        
+        float ComputeHullVolume(const std::vector<float>& points) {
+            if (points.size() < 12) {
+                return 0.0f; // Fewer than four points: flat
+            }
+            btConvexHullComputer hull;
+            hull.compute(points.data(), 3 * sizeof(float), static_cast<int>(points.size() / 3), 0.0f, 0.0f);
+            return ComputeHullVolume(hull);
+        }
+        
+        void EvaluateSplit(const CollisionMesh& mesh, Part& part, uint32_t candidates) {
+            part.Evaluated = true;
+            part.BestGain = 0.0f;
+            if (part.Triangles.size() < 2) {
+                return;
+            }
+            
+            float minimum[3] = { INFINITY, INFINITY, INFINITY };
+            float maximum[3] = { -INFINITY, -INFINITY, -INFINITY };
+            for (uint32_t triangle : part.Triangles) {
+                for (int axis = 0; axis < 3; ++axis) {
+                    float centroid = Centroid(mesh, triangle, axis);
+                    minimum[axis] = std::min(minimum[axis], centroid);
+                    maximum[axis] = std::max(maximum[axis], centroid);
+                }
+            }
+            
+            std::vector<uint32_t> below;
+            std::vector<uint32_t> above;
+            for (int axis = 0; axis < 3; ++axis) {
+                for (uint32_t candidate = 1; candidate <= candidates; ++candidate) {
+                    float position = minimum[axis] + (maximum[axis] - minimum[axis]) * candidate / (candidates + 1);
+                    
+                    below.clear();
+                    above.clear();
+                    for (uint32_t triangle : part.Triangles) {
+                        (Centroid(mesh, triangle, axis) < position ? below : above).push_back(triangle);
+                    }
+                    if (below.empty() || above.empty()) {
+                        continue;
+                    }
+                    
+                    float gain = part.HullVolume -
+                        ComputeHullVolume(GatherPoints(mesh, below)) -
+                        ComputeHullVolume(GatherPoints(mesh, above));
+                    if (gain > part.BestGain) {
+                        part.BestGain = gain;
+                        part.SplitAxis = axis;
+                        part.SplitPosition = position;
+                    }
+                }
+            }
+        }
+        
+        // Hull vertices, reduced to the extreme points along evenly spread
+        // directions when there are too many
+        ConvexHull BuildHull(const std::vector<float>& points, uint32_t maxVertices) {
+            ConvexHull result;
+            if (points.empty()) {
+                return result;
+            }
+            
+            btConvexHullComputer hull;
+            hull.compute(points.data(), 3 * sizeof(float), static_cast<int>(points.size() / 3), 0.0f, 0.0f);
+            int vertexCount = hull.vertices.size();
+            
+            if (vertexCount <= static_cast<int>(maxVertices)) {
+                for (int i = 0; i < vertexCount; ++i) {
+                    result.Points.insert(result.Points.end(), { hull.vertices[i].x(), hull.vertices[i].y(), hull.vertices[i].z() });
+                }
+                return result;
+            }
+            
+            std::vector<int> selected;
+            const float goldenAngle = 2.39996323f;
+            for (uint32_t i = 0; i < maxVertices; ++i) {
+                // Fibonacci sphere
+                float y = 1.0f - 2.0f * (i + 0.5f) / maxVertices;
+                float radius = std::sqrt(1.0f - y * y);
+                btVector3 direction(radius * std::cos(goldenAngle * i), y, radius * std::sin(goldenAngle * i));
+                
+                int best = 0;
+                float bestDot = hull.vertices[0].dot(direction);
+                for (int v = 1; v < vertexCount; ++v) {
+                    float dot = hull.vertices[v].dot(direction);
+                    if (dot > bestDot) {
+                        bestDot = dot;
+                        best = v;
+                    }
+                }
+                selected.push_back(best);
+            }
+            
+            std::sort(selected.begin(), selected.end());
+            selected.erase(std::unique(selected.begin(), selected.end()), selected.end());
+            for (int v : selected) {
+                result.Points.insert(result.Points.end(), { hull.vertices[v].x(), hull.vertices[v].y(), hull.vertices[v].z() });
+            }
+            return result;
+        }
+        
+        // Owns its children; btCompoundShape only references them. Hulls are
+        // added in mesh space, then CenterOnMass() moves the compound's origin
+        // to the center of mass and its axes to the principal axes of inertia.
+        class ConvexCompoundShape : public btCompoundShape {
+        public:
+            ConvexCompoundShape() : btCompoundShape(true) {}
+            
+            void AddHull(const ConvexHull& hull, const Vector3& scale) {
+                std::vector<float> points(hull.Points.size());
+                for (size_t i = 0; i < points.size(); i += 3) {
+                    points[i + 0] = hull.Points[i + 0] * scale.x;
+                    points[i + 1] = hull.Points[i + 1] * scale.y;
+                    points[i + 2] = hull.Points[i + 2] * scale.z;
+                }
+                
+                // Each child sits at its own centroid, which is where
+                // calculatePrincipalAxisTransform() takes its mass to be
+                HullMass mass;
+                if (points.size() >= 12) {
+                    btConvexHullComputer computer;
+                    computer.compute(points.data(), 3 * sizeof(float), static_cast<int>(points.size() / 3), 0.0f, 0.0f);
+                    mass = ComputeHullMass(computer);
+                }
+                if (mass.Volume == 0.0f && !points.empty()) {
+                    // Flat: the average of its points
+                    for (size_t i = 0; i < points.size(); i += 3) {
+                        mass.Centroid += btVector3(points[i], points[i + 1], points[i + 2]);
+                    }
+                    mass.Centroid /= static_cast<float>(points.size() / 3);
+                }
+                
+                auto shape = std::make_unique<btConvexHullShape>();
+                for (size_t i = 0; i < points.size(); i += 3) {
+                    shape->addPoint(btVector3(points[i], points[i + 1], points[i + 2]) - mass.Centroid, false);
+                }
+                shape->recalcLocalAabb();
+                
+                addChildShape(btTransform(btQuaternion::getIdentity(), mass.Centroid), shape.get());
+                m_Hulls.push_back(std::move(shape));
+                m_Volumes.push_back(mass.Volume);
+            }
+            
+            void CenterOnMass() {
+                // Uniform density; flat hulls weigh nothing unless all are flat
+                float totalVolume = 0.0f;
+                for (float volume : m_Volumes) {
+                    totalVolume += volume;
+                }
+                std::vector<btScalar> masses(m_Volumes.size(), btScalar(1) / m_Volumes.size());
+                if (totalVolume > 0.0f) {
+                    for (size_t i = 0; i < masses.size(); ++i) {
+                        masses[i] = m_Volumes[i] / totalVolume;
+                    }
+                }
+                
+                // Unit total mass, so the inertia is per unit of mass
+                calculatePrincipalAxisTransform(masses.data(), m_CenterOfMass, m_InertiaPerMass);
+                btTransform toPrincipal = m_CenterOfMass.inverse();
+                for (int i = 0; i < getNumChildShapes(); ++i) {
+                    updateChildTransform(i, toPrincipal * getChildTransform(i), false);
+                }
+                recalculateLocalAabb();
+            }
+            
+            const btTransform& GetCenterOfMass() const { return m_CenterOfMass; }
+            
+            // btCompoundShape approximates inertia by its bounding box
+            void calculateLocalInertia(btScalar mass, btVector3& inertia) const override {
+                inertia = m_InertiaPerMass * mass;
+            }
+            
+        private:
+            std::vector<std::unique_ptr<btConvexHullShape>> m_Hulls;
+            std::vector<float> m_Volumes;
+            btTransform m_CenterOfMass = btTransform::getIdentity();
+            btVector3 m_InertiaPerMass{ 0, 0, 0 };
+        };
+        
+    } // namespace
+    
+    uint64_t ConvexDecompositionSettings::GetHash() const {
+        uint32_t gainBits;
+        std::memcpy(&gainBits, &MinVolumeGain, sizeof(gainBits));
+        
+        uint64_t hash = 0xcbf29ce484222325ull;
+        for (uint32_t value : { MaxHulls, MaxVerticesPerHull, SplitCandidates, gainBits }) {
+            hash = (hash ^ value) * 0x100000001b3ull;
+        }
+        return hash;
+    }
+    
+    std::vector<ConvexHull> ConvexDecomposition::Decompose(const CollisionMesh& mesh, const ConvexDecompositionSettings& settings) {
+        std::vector<ConvexHull> hulls;
+        if (mesh.IsEmpty()) {
+            return hulls;
+        }
+        
+        std::vector<Part> parts(1);
+        parts[0].Triangles.resize(mesh.GetTriangleCount());
+        for (uint32_t i = 0; i < parts[0].Triangles.size(); ++i) {
+            parts[0].Triangles[i] = i;
+        }
+        parts[0].HullVolume = ComputeHullVolume(GatherPoints(mesh, parts[0].Triangles));
+        float minGain = parts[0].HullVolume * settings.MinVolumeGain;
+        
+        while (parts.size() < std::max(settings.MaxHulls, 1u)) {
+            // Candidate splits of the new parts are independent
+            JobSystem::ParallelFor(parts.size(), 1, [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    if (!parts[i].Evaluated) {
+                        EvaluateSplit(mesh, parts[i], std::max(settings.SplitCandidates, 1u));
+                    }
+                }
+            });
+            
+            auto best = std::max_element(parts.begin(), parts.end(),
+                [](const Part& a, const Part& b) { return a.BestGain < b.BestGain; });
+            if (best->BestGain <= minGain) {
+                break;
+            }
+            
+            Part above;
+            std::vector<uint32_t> below;
+            for (uint32_t triangle : best->Triangles) {
+                if (Centroid(mesh, triangle, best->SplitAxis) < best->SplitPosition) {
+                    below.push_back(triangle);
+                } else {
+                    above.Triangles.push_back(triangle);
+                }
+            }
+            
+            best->Triangles = std::move(below);
+            best->HullVolume = ComputeHullVolume(GatherPoints(mesh, best->Triangles));
+            best->Evaluated = false;
+            above.HullVolume = ComputeHullVolume(GatherPoints(mesh, above.Triangles));
+            parts.push_back(std::move(above));
+        }
+        
+        hulls.resize(parts.size());
+        JobSystem::ParallelFor(parts.size(), 1, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                hulls[i] = BuildHull(GatherPoints(mesh, parts[i].Triangles), std::max(settings.MaxVerticesPerHull, 4u));
+            }
+        });
+        
+        hulls.erase(std::remove_if(hulls.begin(), hulls.end(),
+            [](const ConvexHull& hull) { return hull.Points.empty(); }), hulls.end());
+        return hulls;
+    }
+    
+    bool ConvexDecomposition::SaveHulls(const std::string& path, uint64_t contentHash, const ConvexDecompositionSettings& settings,
+                                        const std::vector<ConvexHull>& hulls) {
+        HullCacheHeader header{ HullCacheMagic, HullCacheVersion, static_cast<uint32_t>(hulls.size()), 0,
+                                contentHash, settings.GetHash() };
+        
+        // Write to a temporary file so a crash never leaves a torn cache
+        std::string tempPath = path + ".tmp";
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        for (const ConvexHull& hull : hulls) {
+            uint32_t count = static_cast<uint32_t>(hull.GetPointCount());
+            file.write(reinterpret_cast<const char*>(&count), sizeof(count));
+            file.write(reinterpret_cast<const char*>(hull.Points.data()), count * 3 * sizeof(float));
+        }
+        file.close();
+        
+        std::error_code error;
+        if (file) {
+            std::filesystem::rename(tempPath, path, error);
+        }
+        if (!file || error) {
+            std::filesystem::remove(tempPath, error);
+            YUGA_LOG_WARN("Failed to write convex hull cache: ", path);
+            return false;
+        }
+        return true;
+    }
+    
+    bool ConvexDecomposition::LoadHulls(const std::string& path, uint64_t contentHash, const ConvexDecompositionSettings& settings,
+                                        std::vector<ConvexHull>& hulls) {
+        std::ifstream file(path, std::ios::binary);
+        if (!file) {
+            return false;
+        }
+        
+        HullCacheHeader header;
+        if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+            header.Magic != HullCacheMagic || header.Version != HullCacheVersion ||
+            header.ContentHash != contentHash || header.SettingsHash != settings.GetHash()) {
+            return false;
+        }
+        
+        std::vector<ConvexHull> loaded(header.HullCount);
+        for (ConvexHull& hull : loaded) {
+            uint32_t count = 0;
+            if (!file.read(reinterpret_cast<char*>(&count), sizeof(count)) || count > (1u << 20)) {
+                return false;
+            }
+            hull.Points.resize(count * 3);
+            if (!file.read(reinterpret_cast<char*>(hull.Points.data()), count * 3 * sizeof(float))) {
+                return false;
+            }
+        }
+        
+        hulls = std::move(loaded);
+        return true;
+    }
+    
+    bool ConvexDecomposition::BuildCache(const Model& model, const ConvexDecompositionSettings& settings) {
+        CollisionMesh mesh = CollisionMesh::FromModel(model);
+        std::string path = GetCachePath(model.GetPath());
+        
+        std::vector<ConvexHull> hulls;
+        if (LoadHulls(path, mesh.ContentHash, settings, hulls)) {
+            return true; // Up to date
+        }
+        
+        hulls = Decompose(mesh, settings);
+        YUGA_LOG_INFO("Convex decomposition: ", model.GetPath(), " -> ", hulls.size(), " hulls");
+        return !hulls.empty() && SaveHulls(path, mesh.ContentHash, settings, hulls);
+    }
+    
+    CollisionShapeRef ConvexDecomposition::CreateShape(const CollisionMesh& mesh, const std::string& cachePath,
+                                                       const ConvexDecompositionSettings& settings, const Vector3& scale,
+                                                       btTransform* centerOfMass) {
+        if (mesh.IsEmpty()) {
+            YUGA_LOG_WARN("Convex mesh collider requested for an empty mesh");
+            return nullptr;
+        }
+        
+        uint64_t shapeId = mesh.ContentHash ^ settings.GetHash() * 0x9e3779b97f4a7c15ull;
+        CollisionShapeRef shape = CollisionShapeCache::Get().GetMesh(CollisionShape::ConvexMesh, shapeId,
+            [&]() -> std::unique_ptr<btCollisionShape> {
+                std::vector<ConvexHull> hulls;
+                if (cachePath.empty() || !LoadHulls(cachePath, mesh.ContentHash, settings, hulls)) {
+                    if (!settings.DecomposeOnCacheMiss) {
+                        YUGA_LOG_WARN("No convex hull cache for mesh, run ConvexDecomposition::BuildCache in the asset pipeline");
+                        return nullptr;
+                    }
+                    YUGA_LOG_WARN("No convex hull cache for mesh, decomposing at load time");
+                    hulls = Decompose(mesh, settings);
+                    if (!cachePath.empty() && !hulls.empty()) {
+                        SaveHulls(cachePath, mesh.ContentHash, settings, hulls);
+                    }
+                }
+                if (hulls.empty()) {
+                    return nullptr;
+                }
+                
+                auto compound = std::make_unique<ConvexCompoundShape>();
+                for (const ConvexHull& hull : hulls) {
+                    compound->AddHull(hull, scale);
+                }
+                compound->CenterOnMass();
+                return compound;
+            }, scale);
+        
+        if (shape && centerOfMass) {
+            *centerOfMass = static_cast<const ConvexCompoundShape*>(shape->GetShape())->GetCenterOfMass();
+        }
+        return shape;
+    }
+    
+    CollisionShapeRef ConvexDecomposition::CreateShapeForModel(const Model& model, const ConvexDecompositionSettings& settings,
+                                                               const Vector3& scale, btTransform* centerOfMass) {
+        std::string cachePath = model.GetPath().empty() ? std::string() : GetCachePath(model.GetPath());
+        return CreateShape(CollisionMesh::FromModel(model), cachePath, settings, scale, centerOfMass);
+    }
+    
+} // namespace YUGA
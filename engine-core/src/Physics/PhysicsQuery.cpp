@@ -0,0 +1,357 @@
+#include "Physics/PhysicsWorld.h"
+#include "Core/JobSystem.h"
+#include <algorithm>
+#include <BulletCollision/CollisionShapes/btTriangleShape.h>
+#include <BulletCollision/NarrowPhaseCollision/btGjkEpaPenetrationDepthSolver.h>
+#include <BulletCollision/NarrowPhaseCollision/btGjkPairDetector.h>
+#include <BulletCollision/NarrowPhaseCollision/btPointCollector.h>
+#include <BulletCollision/NarrowPhaseCollision/btVoronoiSimplexSolver.h>
+
+// Batched queries. They never go through btCollisionWorld's query entry
+// points, which share scratch state in the broadphase; each query walks the
+// broadphase trees with its own stack and runs Bullet's static narrowphase
+// helpers, so any number of them can run at once while the world is idle.
+// PhysicsWorld only runs them at points where it is.
+
+namespace YUGA {
+    
+    namespace {
+        
+        constexpr size_t QueryBatchSize = 32;
+        
+        btVector3 ToBullet(const Vector3& v) { return btVector3(v.x, v.y, v.z); }
+        btQuaternion ToBullet(const Quaternion& q) { return btQuaternion(q.x, q.y, q.z, q.w); }
+        Vector3 ToVector3(const btVector3& v) { return Vector3(v.x(), v.y(), v.z()); }
+        
+        uint32_t GetEntity(const btCollisionObject* object) {
+            // PhysicsSystem stores the entity; Bullet's default of -1 maps to NullQueryEntity
+            return static_cast<uint32_t>(object->getUserIndex());
+        }
+        
+        bool PassesFilter(const btBroadphaseProxy* proxy, int mask, uint32_t ignoreEntity) {
+            if ((proxy->m_collisionFilterGroup & mask) == 0) {
+                return false;
+            }
+            return ignoreEntity == NullQueryEntity ||
+                   GetEntity(static_cast<const btCollisionObject*>(proxy->m_clientObject)) != ignoreEntity;
+        }
+        
+        template<typename Fn>
+        class LeafVisitor : public btDbvt::ICollide {
+        public:
+            explicit LeafVisitor(Fn& fn) : m_Fn(fn) {}
+            
+            void Process(const btDbvtNode* leaf) override {
+                m_Fn(static_cast<const btBroadphaseProxy*>(leaf->data));
+            }
+            
+        private:
+            Fn& m_Fn;
+        };
+        
+        // Broadphase proxies of both trees (moving and static) along a ray
+        template<typename Fn>
+        void ForEachProxyOnRay(const btDbvtBroadphase& broadphase, const btVector3& from, const btVector3& to, Fn&& fn) {
+            LeafVisitor<Fn> visitor(fn);
+            for (const btDbvt& tree : broadphase.m_sets) {
+                btDbvt::rayTest(tree.m_root, from, to, visitor);
+            }
+        }
+        
+        // Broadphase proxies of both trees overlapping a box
+        template<typename Fn>
+        void ForEachProxyInBox(const btDbvtBroadphase& broadphase, const btVector3& min, const btVector3& max, Fn&& fn) {
+            LeafVisitor<Fn> visitor(fn);
+            btDbvtVolume volume = btDbvtVolume::FromMM(min, max);
+            for (const btDbvt& tree : broadphase.m_sets) {
+                tree.collideTV(tree.m_root, volume, visitor);
+            }
+        }
+        
+        // Stack-allocated query shape
+        template<typename Fn>
+        void WithConvexShape(CollisionShape type, const Vector3& size, Fn&& fn) {
+            switch (type) {
+                case CollisionShape::Sphere: {
+                    btSphereShape shape(size.x * 0.5f);
+                    fn(shape);
+                    break;
+                }
+                case CollisionShape::Capsule: {
+                    btCapsuleShape shape(size.x * 0.5f, size.y);
+                    fn(shape);
+                    break;
+                }
+                default: {
+                    btBoxShape shape(btVector3(size.x * 0.5f, size.y * 0.5f, size.z * 0.5f));
+                    fn(shape);
+                    break;
+                }
+            }
+        }
+        
+        void RunRaycast(const btDbvtBroadphase& broadphase, const RayQuery& query, QueryHit& hit) {
+            btVector3 from = ToBullet(query.From);
+            btVector3 to = ToBullet(query.To);
+            btTransform fromTransform(btQuaternion::getIdentity(), from);
+            btTransform toTransform(btQuaternion::getIdentity(), to);
+            
+            btCollisionWorld::ClosestRayResultCallback callback(from, to);
+            ForEachProxyOnRay(broadphase, from, to, [&](const btBroadphaseProxy* proxy) {
+                if (!PassesFilter(proxy, query.CollisionMask, query.IgnoreEntity)) {
+                    return;
+                }
+                btCollisionObject* object = static_cast<btCollisionObject*>(proxy->m_clientObject);
+                btCollisionWorld::rayTestSingle(fromTransform, toTransform, object, object->getCollisionShape(),
+                                                object->getWorldTransform(), callback);
+            });
+            
+            hit = QueryHit();
+            if (callback.hasHit()) {
+                hit.Entity = GetEntity(callback.m_collisionObject);
+                hit.Point = ToVector3(callback.m_hitPointWorld);
+                hit.Normal = ToVector3(callback.m_hitNormalWorld.normalized());
+                hit.Fraction = callback.m_closestHitFraction;
+                hit.Hit = true;
+            }
+        }
+        
+        void RunSweep(const btDbvtBroadphase& broadphase, const SweepQuery& query, QueryHit& hit) {
+            hit = QueryHit();
+            btQuaternion rotation = ToBullet(query.Rotation);
+            btTransform fromTransform(rotation, ToBullet(query.From));
+            btTransform toTransform(rotation, ToBullet(query.To));
+            
+            WithConvexShape(query.Shape, query.Size, [&](const btConvexShape& shape) {
+                // Box around the swept volume
+                btVector3 min, max, toMin, toMax;
+                shape.getAabb(fromTransform, min, max);
+                shape.getAabb(toTransform, toMin, toMax);
+                min.setMin(toMin);
+                max.setMax(toMax);
+                
+                btCollisionWorld::ClosestConvexResultCallback callback(fromTransform.getOrigin(), toTransform.getOrigin());
+                ForEachProxyInBox(broadphase, min, max, [&](const btBroadphaseProxy* proxy) {
+                    if (!PassesFilter(proxy, query.CollisionMask, query.IgnoreEntity)) {
+                        return;
+                    }
+                    btCollisionObject* object = static_cast<btCollisionObject*>(proxy->m_clientObject);
+                    btCollisionWorld::objectQuerySingle(&shape, fromTransform, toTransform, object, object->getCollisionShape(),
+                                                        object->getWorldTransform(), callback, 0.0f);
+                });
+                
+                if (callback.hasHit()) {
+                    hit.Entity = GetEntity(callback.m_hitCollisionObject);
+                    hit.Point = ToVector3(callback.m_hitPointWorld);
+                    hit.Normal = ToVector3(callback.m_hitNormalWorld.normalized());
+                    hit.Fraction = callback.m_closestHitFraction;
+                    hit.Hit = true;
+                }
+            });
+        }
+        
+        bool TestConvexOverlap(const btConvexShape& query, const btTransform& queryTransform,
+                               const btConvexShape& shape, const btTransform& transform, QueryHit& hit) {
+            btVoronoiSimplexSolver simplexSolver;
+            btGjkEpaPenetrationDepthSolver penetrationSolver;
+            btGjkPairDetector detector(&query, &shape, &simplexSolver, &penetrationSolver);
+            
+            btGjkPairDetector::ClosestPointInput input;
+            input.m_transformA = queryTransform;
+            input.m_transformB = transform;
+            btPointCollector output;
+            detector.getClosestPoints(input, output, nullptr);
+            
+            if (!output.m_hasResult || output.m_distance > 0.0f) {
+                return false;
+            }
+            hit.Point = ToVector3(output.m_pointInWorld);
+            hit.Normal = ToVector3(output.m_normalOnBInWorld);
+            return true;
+        }
+        
+        class TriangleOverlapCallback : public btTriangleCallback {
+        public:
+            TriangleOverlapCallback(const btConvexShape& query, const btTransform& queryTransform,
+                                    const btTransform& transform, QueryHit& hit)
+                : m_Query(query), m_QueryTransform(queryTransform), m_Transform(transform), m_Hit(hit) {}
+            
+            void processTriangle(btVector3* triangle, int, int) override {
+                if (m_Found) {
+                    return;
+                }
+                btTriangleShape shape(triangle[0], triangle[1], triangle[2]);
+                m_Found = TestConvexOverlap(m_Query, m_QueryTransform, shape, m_Transform, m_Hit);
+            }
+            
+            bool IsFound() const { return m_Found; }
+            
+        private:
+            const btConvexShape& m_Query;
+            const btTransform& m_QueryTransform;
+            const btTransform& m_Transform;
+            QueryHit& m_Hit;
+            bool m_Found = false;
+        };
+        
+        bool TestOverlap(const btConvexShape& query, const btTransform& queryTransform,
+                         const btCollisionShape* shape, const btTransform& transform, QueryHit& hit) {
+            if (shape->isConvex()) {
+                return TestConvexOverlap(query, queryTransform, *static_cast<const btConvexShape*>(shape), transform, hit);
+            }
+            
+            if (shape->isCompound()) {
+                const btCompoundShape* compound = static_cast<const btCompoundShape*>(shape);
+                for (int i = 0; i < compound->getNumChildShapes(); ++i) {
+                    if (TestOverlap(query, queryTransform, compound->getChildShape(i),
+                                    transform * compound->getChildTransform(i), hit)) {
+                        return true;
+                    }
+                }
+                return false;
+            }
+            
+            if (shape->isConcave()) {
+                // Only the triangles under the query's box, in the shape's space
+                btVector3 min, max;
+                query.getAabb(transform.inverse() * queryTransform, min, max);
+                TriangleOverlapCallback callback(query, queryTransform, transform, hit);
+                static_cast<const btConcaveShape*>(shape)->processAllTriangles(&callback, min, max);
+                return callback.IsFound();
+            }
+            
+            return false;
+        }
+        
+        void RunOverlap(const btDbvtBroadphase& broadphase, const OverlapQuery& query, std::vector<QueryHit>& hits) {
+            btTransform queryTransform(ToBullet(query.Rotation), ToBullet(query.Position));
+            
+            WithConvexShape(query.Shape, query.Size, [&](const btConvexShape& shape) {
+                btVector3 min, max;
+                shape.getAabb(queryTransform, min, max);
+                
+                ForEachProxyInBox(broadphase, min, max, [&](const btBroadphaseProxy* proxy) {
+                    if (!PassesFilter(proxy, query.CollisionMask, query.IgnoreEntity)) {
+                        return;
+                    }
+                    const btCollisionObject* object = static_cast<const btCollisionObject*>(proxy->m_clientObject);
+                    QueryHit hit;
+                    if (TestOverlap(shape, queryTransform, object->getCollisionShape(), object->getWorldTransform(), hit)) {
+                        hit.Entity = GetEntity(object);
+                        hit.Fraction = 0.0f;
+                        hit.Hit = true;
+                        hits.push_back(hit);
+                    }
+                });
+            });
+        }
+        
+    } // namespace
+    
+    void PhysicsWorld::RaycastBatch(std::vector<RayQuery> queries, QueryCallback onResults) {
+        RunQueries([this, queries = std::move(queries), onResults = std::move(onResults)] {
+            std::vector<QueryHit> hits;
+            ExecuteRaycasts(queries, hits);
+            onResults(hits);
+        });
+    }
+    
+    void PhysicsWorld::SweepBatch(std::vector<SweepQuery> queries, QueryCallback onResults) {
+        RunQueries([this, queries = std::move(queries), onResults = std::move(onResults)] {
+            std::vector<QueryHit> hits;
+            ExecuteSweeps(queries, hits);
+            onResults(hits);
+        });
+    }
+    
+    void PhysicsWorld::OverlapBatch(std::vector<OverlapQuery> queries, OverlapQueryCallback onResults) {
+        RunQueries([this, queries = std::move(queries), onResults = std::move(onResults)] {
+            std::vector<QueryHit> hits;
+            std::vector<QueryHitRange> ranges;
+            ExecuteOverlaps(queries, hits, ranges);
+            onResults(hits, ranges);
+        });
+    }
+    
+    void PhysicsWorld::RunQueries(std::function<void()> batch) {
+        if (m_Mode == PhysicsMode::Synchronous) {
+            batch();
+        } else {
+            m_PendingQueries.push_back(std::move(batch));
+        }
+    }
+    
+    void PhysicsWorld::RunPendingQueries() {
+        // Batches submitted from a callback wait for the next sync point
+        std::vector<std::function<void()>> batches;
+        batches.swap(m_PendingQueries);
+        for (auto& batch : batches) {
+            batch();
+        }
+    }
+    
+    void PhysicsWorld::ExecuteRaycasts(const std::vector<RayQuery>& queries, std::vector<QueryHit>& hits) const {
+        hits.assign(queries.size(), QueryHit());
+        if (!m_DynamicsWorld) return;
+        
+        const btDbvtBroadphase& broadphase = static_cast<const btDbvtBroadphase&>(*m_Broadphase);
+        JobSystem::ParallelFor(queries.size(), QueryBatchSize, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                RunRaycast(broadphase, queries[i], hits[i]);
+            }
+        });
+    }
+    
+    void PhysicsWorld::ExecuteSweeps(const std::vector<SweepQuery>& queries, std::vector<QueryHit>& hits) const {
+        hits.assign(queries.size(), QueryHit());
+        if (!m_DynamicsWorld) return;
+        
+        const btDbvtBroadphase& broadphase = static_cast<const btDbvtBroadphase&>(*m_Broadphase);
+        JobSystem::ParallelFor(queries.size(), QueryBatchSize, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                RunSweep(broadphase, queries[i], hits[i]);
+            }
+        });
+    }
+    
+    void PhysicsWorld::ExecuteOverlaps(const std::vector<OverlapQuery>& queries, std::vector<QueryHit>& hits,
+                                       std::vector<QueryHitRange>& ranges) const {
+        hits.clear();
+        ranges.assign(queries.size(), QueryHitRange());
+        if (!m_DynamicsWorld || queries.empty()) return;
+        
+        const btDbvtBroadphase& broadphase = static_cast<const btDbvtBroadphase&>(*m_Broadphase);
+        
+        // Each batch of queries collects its hits separately; the batches are
+        // then concatenated in order
+        std::vector<std::vector<QueryHit>> batchHits((queries.size() + QueryBatchSize - 1) / QueryBatchSize);
+        JobSystem::ParallelFor(batchHits.size(), 1, [&](size_t firstBatch, size_t lastBatch) {
+            for (size_t batch = firstBatch; batch < lastBatch; ++batch) {
+                std::vector<QueryHit>& local = batchHits[batch];
+                size_t end = std::min((batch + 1) * QueryBatchSize, queries.size());
+                for (size_t i = batch * QueryBatchSize; i < end; ++i) {
+                    ranges[i].First = static_cast<uint32_t>(local.size());
+                    RunOverlap(broadphase, queries[i], local);
+                    ranges[i].Count = static_cast<uint32_t>(local.size()) - ranges[i].First;
+                }
+            }
+        });
+        
+        size_t total = 0;
+        for (const std::vector<QueryHit>& local : batchHits) {
+            total += local.size();
+        }
+        hits.reserve(total);
+        
+        for (size_t batch = 0; batch < batchHits.size(); ++batch) {
+            uint32_t offset = static_cast<uint32_t>(hits.size());
+            hits.insert(hits.end(), batchHits[batch].begin(), batchHits[batch].end());
+            
+            size_t end = std::min((batch + 1) * QueryBatchSize, queries.size());
+            for (size_t i = batch * QueryBatchSize; i < end; ++i) {
+                ranges[i].First += offset;
+            }
+        }
+    }
+    
+} // namespace YUGA
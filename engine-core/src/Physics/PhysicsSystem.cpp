@@ -0,0 +1,260 @@
+#include "Physics/PhysicsSystem.h"
+#include "Physics/PhysicsWorld.h"
+#include "Physics/RigidBody.h"
+#include "Physics/TriangleMeshCollider.h"
+#include "ECS/Components.h"
+#include "Assets/AssetManager.h"
+#include "Core/Log.h"
+
+namespace YUGA {
+    
+    namespace {
+        
+        bool Equal(const Vector3& a, const Vector3& b) {
+            return a.x == b.x && a.y == b.y && a.z == b.z;
+        }
+        
+        bool IsZero(const Vector3& v) {
+            return v.x == 0.0f && v.y == 0.0f && v.z == 0.0f;
+        }
+        
+        CollisionShape ToCollisionShape(ColliderComponent::Shape shape) {
+            switch (shape) {
+                case ColliderComponent::Shape::Box:        return CollisionShape::Box;
+                case ColliderComponent::Shape::Sphere:     return CollisionShape::Sphere;
+                case ColliderComponent::Shape::Capsule:    return CollisionShape::Capsule;
+                case ColliderComponent::Shape::Mesh:       return CollisionShape::Mesh;
+                case ColliderComponent::Shape::ConvexMesh: return CollisionShape::ConvexMesh;
+            }
+            return CollisionShape::Box;
+        }
+        
+    } // namespace
+    
+    PhysicsSystem::PhysicsSystem(PhysicsWorld& world, entt::registry& registry)
+        : m_World(world), m_Registry(registry) {
+        
+        m_Registry.on_construct<RigidBodyComponent>().connect<&PhysicsSystem::OnBodyAdded>(this);
+        m_Registry.on_update<RigidBodyComponent>().connect<&PhysicsSystem::OnBodyChanged>(this);
+        m_Registry.on_destroy<RigidBodyComponent>().connect<&PhysicsSystem::OnBodyRemoved>(this);
+        m_Registry.on_construct<ColliderComponent>().connect<&PhysicsSystem::OnBodyChanged>(this);
+        m_Registry.on_update<ColliderComponent>().connect<&PhysicsSystem::OnBodyChanged>(this);
+        m_Registry.on_destroy<ColliderComponent>().connect<&PhysicsSystem::OnBodyChanged>(this);
+        
+        // Pick up bodies that existed before the system
+        for (auto entity : m_Registry.view<RigidBodyComponent>()) {
+            m_PendingCreates.push_back(entity);
+        }
+    }
+    
+    PhysicsSystem::~PhysicsSystem() {
+        m_Registry.on_construct<RigidBodyComponent>().disconnect<&PhysicsSystem::OnBodyAdded>(this);
+        m_Registry.on_update<RigidBodyComponent>().disconnect<&PhysicsSystem::OnBodyChanged>(this);
+        m_Registry.on_destroy<RigidBodyComponent>().disconnect<&PhysicsSystem::OnBodyRemoved>(this);
+        m_Registry.on_construct<ColliderComponent>().disconnect<&PhysicsSystem::OnBodyChanged>(this);
+        m_Registry.on_update<ColliderComponent>().disconnect<&PhysicsSystem::OnBodyChanged>(this);
+        m_Registry.on_destroy<ColliderComponent>().disconnect<&PhysicsSystem::OnBodyChanged>(this);
+        
+        for (auto entity : m_Registry.view<RigidBodyComponent>()) {
+            m_Registry.get<RigidBodyComponent>(entity).Body = nullptr;
+        }
+        m_Registry.clear<PhysicsBodyState>();
+        m_PendingDestroys.clear();
+    }
+    
+    void PhysicsSystem::OnBodyAdded(entt::registry&, entt::entity entity) {
+        m_PendingCreates.push_back(entity);
+    }
+    
+    void PhysicsSystem::OnBodyRemoved(entt::registry&, entt::entity entity) {
+        DestroyBody(entity);
+    }
+    
+    void PhysicsSystem::OnBodyChanged(entt::registry& registry, entt::entity entity) {
+        // Mass, flags and shape are baked into the Bullet body: rebuild it
+        if (registry.all_of<RigidBodyComponent>(entity)) {
+            DestroyBody(entity);
+            m_PendingCreates.push_back(entity);
+        }
+    }
+    
+    void PhysicsSystem::DestroyBody(entt::entity entity) {
+        // Defer the actual removal so it is batched with the frame's other
+        // changes instead of stalling on an in-flight step mid-frame
+        if (PhysicsBodyState* state = m_Registry.try_get<PhysicsBodyState>(entity)) {
+            m_PendingDestroys.push_back(std::move(state->Body));
+            m_Registry.remove<PhysicsBodyState>(entity);
+            --m_BodyCount;
+        }
+        
+        if (RigidBodyComponent* rigidBody = m_Registry.try_get<RigidBodyComponent>(entity)) {
+            rigidBody->Body = nullptr;
+        }
+    }
+    
+    void PhysicsSystem::CreateBody(entt::entity entity) {
+        if (!m_Registry.valid(entity) || m_Registry.all_of<PhysicsBodyState>(entity)) {
+            return;
+        }
+        
+        RigidBodyComponent* rigidBody = m_Registry.try_get<RigidBodyComponent>(entity);
+        TransformComponent* transform = m_Registry.try_get<TransformComponent>(entity);
+        if (!rigidBody || !transform) {
+            return;
+        }
+        
+        const ColliderComponent* collider = m_Registry.try_get<ColliderComponent>(entity);
+        btTransform centerOfMass;
+        CollisionShapeRef shape = CreateShape(entity, collider, *transform, centerOfMass);
+        
+        // Kinematic bodies are driven by the game and must be massless in
+        // Bullet; triangle meshes can only be static
+        float mass = rigidBody->IsKinematic ? 0.0f : rigidBody->Mass;
+        if (mass != 0.0f && shape->GetShape()->isConcave()) {
+            YUGA_LOG_WARN("Triangle mesh colliders are static only, ignoring mass");
+            mass = 0.0f;
+        }
+        
+        // Pooled body; identical colliders share one cached shape
+        Ref<RigidBody> body = CreateRef<RigidBody>(std::move(shape), mass);
+        if (!body) {
+            return;
+        }
+        
+        // Not in a world yet, so these apply immediately
+        Vector3 offset = collider ? collider->Center * transform->Scale : Vector3(0.0f, 0.0f, 0.0f);
+        const btVector3& massCenter = centerOfMass.getOrigin();
+        offset += Vector3(massCenter.x(), massCenter.y(), massCenter.z());
+        btQuaternion principal = centerOfMass.getRotation();
+        Quaternion offsetRotation(principal.x(), principal.y(), principal.z(), principal.w());
+        
+        Quaternion rotation = Quaternion::FromEulerAngles(transform->Rotation);
+        Quaternion bodyRotation = rotation * offsetRotation;
+        body->SetPosition(transform->Position + rotation.RotateVector(offset));
+        body->SetRotation(btQuaternion(bodyRotation.x, bodyRotation.y, bodyRotation.z, bodyRotation.w));
+        if (rigidBody->IsKinematic) {
+            body->SetKinematic(true);
+        }
+        
+        btRigidBody* bulletBody = body->GetBulletBody();
+        bulletBody->setLinearVelocity(btVector3(rigidBody->Velocity.x, rigidBody->Velocity.y, rigidBody->Velocity.z));
+        bulletBody->setUserIndex(static_cast<int>(entt::to_integral(entity)));
+        if (collider && collider->IsTrigger) {
+            bulletBody->setCollisionFlags(bulletBody->getCollisionFlags() | btCollisionObject::CF_NO_CONTACT_RESPONSE);
+        }
+        
+        m_World.AddRigidBody(body.get());
+        rigidBody->Body = body.get();
+        
+        PhysicsBodyState& state = m_Registry.emplace<PhysicsBodyState>(entity);
+        state.Body = std::move(body);
+        state.SyncedPosition = transform->Position;
+        state.SyncedRotation = transform->Rotation;
+        state.BodyOffset = offset;
+        state.BodyRotation = offsetRotation;
+        ++m_BodyCount;
+    }
+    
+    CollisionShapeRef PhysicsSystem::CreateShape(entt::entity entity, const ColliderComponent* collider,
+                                                 const TransformComponent& transform, btTransform& centerOfMass) {
+        centerOfMass.setIdentity();
+        if (!collider) {
+            return CollisionShapeCache::Get().GetPrimitive(CollisionShape::Box, transform.Scale);
+        }
+        
+        Vector3 size = collider->Size * transform.Scale;
+        if (collider->ColliderShape == ColliderComponent::Shape::Mesh) {
+            // Triangle mesh from the entity's model, shared by every instance
+            const MeshComponent* mesh = m_Registry.try_get<MeshComponent>(entity);
+            Model* model = mesh ? AssetManager::Get().GetModel(mesh->MeshId) : nullptr;
+            if (model) {
+                if (CollisionShapeRef shape = TriangleMeshCollider::CreateForModel(*model)) {
+                    return CollisionShapeCache::Get().GetScaled(shape, size);
+                }
+            }
+        } else if (collider->ColliderShape == ColliderComponent::Shape::ConvexMesh) {
+            // Compound of convex hulls from the model's hull cache, usable by dynamic bodies
+            const MeshComponent* mesh = m_Registry.try_get<MeshComponent>(entity);
+            Model* model = mesh ? AssetManager::Get().GetModel(mesh->MeshId) : nullptr;
+            if (model) {
+                if (CollisionShapeRef shape = ConvexDecomposition::CreateShapeForModel(*model, m_DecompositionSettings, size, &centerOfMass)) {
+                    return shape;
+                }
+            }
+        }
+        
+        return CollisionShapeCache::Get().GetPrimitive(ToCollisionShape(collider->ColliderShape), size);
+    }
+    
+    void PhysicsSystem::ApplyPendingChanges() {
+        // Destructors remove the bodies from the world
+        m_PendingDestroys.clear();
+        
+        for (entt::entity entity : m_PendingCreates) {
+            CreateBody(entity);
+        }
+        m_PendingCreates.clear();
+    }
+    
+    void PhysicsSystem::PullTransforms() {
+        const std::vector<PhysicsTransform>& transforms = m_World.GetTransforms();
+        
+        for (uint32_t slot : m_World.GetMovedSlots()) {
+            RigidBody* body = m_World.GetSlotBody(slot);
+            if (!body) {
+                continue;
+            }
+            
+            auto entity = static_cast<entt::entity>(body->GetBulletBody()->getUserIndex());
+            if (!m_Registry.valid(entity)) {
+                continue;
+            }
+            
+            PhysicsBodyState* state = m_Registry.try_get<PhysicsBodyState>(entity);
+            if (!state || state->Body.get() != body) {
+                continue; // Slot belongs to a body this system does not own
+            }
+            
+            auto& transform = m_Registry.get<TransformComponent>(entity);
+            Quaternion rotation = transforms[slot].Rotation * state->BodyRotation.Conjugate();
+            transform.Position = transforms[slot].Position - rotation.RotateVector(state->BodyOffset);
+            transform.Rotation = rotation.ToEulerAngles();
+            state->SyncedPosition = transform.Position;
+            state->SyncedRotation = transform.Rotation;
+        }
+    }
+    
+    void PhysicsSystem::PushTransforms() {
+        ApplyPendingChanges();
+        
+        auto view = m_Registry.view<TransformComponent, RigidBodyComponent, PhysicsBodyState>();
+        for (auto entity : view) {
+            auto& transform = view.get<TransformComponent>(entity);
+            auto& state = view.get<PhysicsBodyState>(entity);
+            
+            bool positionChanged = !Equal(transform.Position, state.SyncedPosition);
+            bool rotationChanged = !Equal(transform.Rotation, state.SyncedRotation);
+            if (!positionChanged && !rotationChanged) {
+                continue;
+            }
+            
+            // Turning an entity moves an off-center body
+            Quaternion rotation = Quaternion::FromEulerAngles(transform.Rotation);
+            if (positionChanged || !IsZero(state.BodyOffset)) {
+                state.Body->SetPosition(transform.Position + rotation.RotateVector(state.BodyOffset));
+            }
+            if (rotationChanged) {
+                Quaternion bodyRotation = rotation * state.BodyRotation;
+                state.Body->SetRotation(btQuaternion(bodyRotation.x, bodyRotation.y, bodyRotation.z, bodyRotation.w));
+            }
+            if (!view.get<RigidBodyComponent>(entity).IsKinematic) {
+                // A teleported body may be asleep
+                state.Body->Activate();
+            }
+            
+            state.SyncedPosition = transform.Position;
+            state.SyncedRotation = transform.Rotation;
+        }
+    }
+    
+} // namespace YUGA
@@ -1,9 +1,163 @@
 #include "Physics/PhysicsWorld.h"
 #include "Physics/RigidBody.h"
 #include "Core/Log.h"
+#include "Core/JobSystem.h"
+#include "Memory/MemoryTracker.h"
+#include <LinearMath/btAlignedAllocator.h>
+#include <LinearMath/btThreads.h>
+#include <BulletCollision/CollisionDispatch/btCollisionDispatcherMt.h>
+#include <BulletDynamics/ConstraintSolver/btSequentialImpulseConstraintSolverMt.h>
+#include <BulletDynamics/Dynamics/btDiscreteDynamicsWorldMt.h>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <thread>
 
 namespace YUGA {
     
+    namespace {
+        
+        uint64_t NanosecondsSince(std::chrono::steady_clock::time_point start) {
+            return static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+        }
+        
+        // Times overlapping pair updates (broadphase) for PhysicsStats
+        class TimedBroadphase : public btDbvtBroadphase {
+        public:
+            explicit TimedBroadphase(uint64_t& nanoseconds) : m_Nanoseconds(nanoseconds) {}
+            
+            void calculateOverlappingPairs(btDispatcher* dispatcher) override {
+                auto start = std::chrono::steady_clock::now();
+                btDbvtBroadphase::calculateOverlappingPairs(dispatcher);
+                m_Nanoseconds += NanosecondsSince(start);
+            }
+            
+        private:
+            uint64_t& m_Nanoseconds;
+        };
+        
+        // Times contact generation for the overlapping pairs (narrowphase)
+        template<typename Dispatcher>
+        class TimedDispatcher : public Dispatcher {
+        public:
+            template<typename... Args>
+            TimedDispatcher(uint64_t& nanoseconds, Args&&... args)
+                : Dispatcher(std::forward<Args>(args)...), m_Nanoseconds(nanoseconds) {}
+            
+            void dispatchAllCollisionPairs(btOverlappingPairCache* pairCache, const btDispatcherInfo& info,
+                                           btDispatcher* dispatcher) override {
+                auto start = std::chrono::steady_clock::now();
+                Dispatcher::dispatchAllCollisionPairs(pairCache, info, dispatcher);
+                m_Nanoseconds += NanosecondsSince(start);
+            }
+            
+        private:
+            uint64_t& m_Nanoseconds;
+        };
+        
+        // Wraps a solver to time its solveGroup() calls; islands may be
+        // solved on several threads at once
+        template<typename Solver>
+        class TimedSolver : public Solver {
+        public:
+            template<typename... Args>
+            TimedSolver(std::atomic<uint64_t>& nanoseconds, std::atomic<uint32_t>& groups, Args&&... args)
+                : Solver(std::forward<Args>(args)...), m_Nanoseconds(nanoseconds), m_Groups(groups) {}
+            
+            btScalar solveGroup(btCollisionObject** bodies, int numBodies, btPersistentManifold** manifolds, int numManifolds,
+                                btTypedConstraint** constraints, int numConstraints, const btContactSolverInfo& info,
+                                btIDebugDraw* debugDrawer, btDispatcher* dispatcher) override {
+                auto start = std::chrono::steady_clock::now();
+                btScalar result = Solver::solveGroup(bodies, numBodies, manifolds, numManifolds, constraints, numConstraints,
+                                                     info, debugDrawer, dispatcher);
+                m_Nanoseconds.fetch_add(NanosecondsSince(start), std::memory_order_relaxed);
+                m_Groups.fetch_add(1, std::memory_order_relaxed);
+                return result;
+            }
+            
+        private:
+            std::atomic<uint64_t>& m_Nanoseconds;
+            std::atomic<uint32_t>& m_Groups;
+        };
+        
+#if BT_THREADSAFE
+        // Runs Bullet's parallel loops on the engine's workers rather than a
+        // second thread pool competing with them.
+        //
+        // Bullet numbers threads in the order they first call into it and
+        // sizes its per-thread arrays (batched manifolds, solver scratch) by
+        // getNumThreads(). InstallGlobalHooks() numbers the main thread 0 and
+        // the workers 1..N, leaving N + 1 for the physics thread. A thread
+        // numbered past that (a physics thread restarted by SetMode) never
+        // runs a loop body itself: its batches all go to the pool.
+        class JobSystemTaskScheduler : public btITaskScheduler {
+        public:
+            JobSystemTaskScheduler() : btITaskScheduler("YUGA JobSystem") {}
+            
+            int getMaxNumThreads() const override { return BT_MAX_THREAD_COUNT; }
+            int getNumThreads() const override {
+                // Main thread, workers, physics thread
+                return std::min(static_cast<int>(JobSystem::GetWorkerCount()) + 2, BT_MAX_THREAD_COUNT);
+            }
+            void setNumThreads(int) override {} // Sized by the JobSystem
+            
+            void parallelFor(int begin, int end, int grainSize, const btIParallelForBody& body) override {
+                Run(static_cast<size_t>(end - begin), static_cast<size_t>(grainSize),
+                    [&](size_t first, size_t last) {
+                        body.forLoop(begin + static_cast<int>(first), begin + static_cast<int>(last));
+                    });
+            }
+            
+            btScalar parallelSum(int begin, int end, int grainSize, const btIParallelSumBody& body) override {
+                size_t count = static_cast<size_t>(end - begin);
+                size_t batchSize = static_cast<size_t>(std::max(grainSize, 1));
+                std::vector<btScalar> sums((count + batchSize - 1) / batchSize, btScalar(0));
+                
+                Run(sums.size(), 1, [&](size_t firstBatch, size_t lastBatch) {
+                    for (size_t batch = firstBatch; batch < lastBatch; ++batch) {
+                        size_t first = batch * batchSize;
+                        size_t last = std::min(first + batchSize, count);
+                        sums[batch] = body.sumLoop(begin + static_cast<int>(first), begin + static_cast<int>(last));
+                    }
+                });
+                
+                btScalar total = 0;
+                for (btScalar sum : sums) {
+                    total += sum;
+                }
+                return total;
+            }
+            
+        private:
+            void Run(size_t count, size_t batchSize, const std::function<void(size_t begin, size_t end)>& body) {
+                if (btGetCurrentThreadIndex() < static_cast<unsigned int>(getNumThreads())) {
+                    JobSystem::ParallelFor(count, batchSize, body);
+                    return;
+                }
+                
+                // Wait without running jobs: any of them may be a Bullet loop body
+                batchSize = std::max<size_t>(batchSize, 1);
+                JobCounter counter;
+                for (size_t first = 0; first < count; first += batchSize) {
+                    size_t last = std::min(first + batchSize, count);
+                    JobSystem::Schedule([&body, first, last] { body(first, last); }, &counter);
+                }
+                while (!counter.IsDone()) {
+                    std::this_thread::yield();
+                }
+            }
+        };
+        
+        JobSystemTaskScheduler& GetTaskScheduler() {
+            // Bullet keeps a raw pointer to the global scheduler
+            static JobSystemTaskScheduler* scheduler = new JobSystemTaskScheduler();
+            return *scheduler;
+        }
+#endif
+        
+    } // namespace
+    
     PhysicsWorld::PhysicsWorld() {
     }
     
@@ -11,43 +165,231 @@ namespace YUGA {
         Shutdown();
     }
     
-    void PhysicsWorld::Initialize() {
-        // Collision configuration
-        m_CollisionConfiguration = std::make_unique<btDefaultCollisionConfiguration>();
+    void PhysicsWorld::InstallGlobalHooks() {
+        // Bullet does not check for failed allocations, so the Physics hard
+        // budget reports an overrun instead of refusing it
+        btAlignedAllocSetCustom(
+            [](size_t size) { return MemoryTracker::AllocateUnrefused(MemoryTag::Physics, size); },
+            [](void* ptr) { MemoryTracker::Free(MemoryTag::Physics, ptr); }
+        );
         
-        // Dispatcher
-        m_Dispatcher = std::make_unique<btCollisionDispatcher>(m_CollisionConfiguration.get());
+#if BT_THREADSAFE
+        // Bullet requires the scheduler be set from its thread 0, which makes
+        // it the main thread's number
+        btSetTaskScheduler(&GetTaskScheduler());
+        
+        // Number every worker next. Each job holds its worker until all have
+        // started one, so no worker runs two.
+        uint32_t workerCount = JobSystem::GetWorkerCount();
+        std::atomic<uint32_t> started{ 0 };
+        JobCounter counter;
+        for (uint32_t i = 0; i < workerCount; ++i) {
+            JobSystem::Schedule([&started, workerCount] {
+                btGetCurrentThreadIndex();
+                started.fetch_add(1, std::memory_order_acq_rel);
+                while (started.load(std::memory_order_acquire) < workerCount) {
+                    std::this_thread::yield();
+                }
+            }, &counter);
+        }
+        while (!counter.IsDone()) {
+            std::this_thread::yield();
+        }
+#endif
+    }
+    
+    void PhysicsWorld::Initialize(const PhysicsWorldConfig& config) {
+        m_Multithreaded = config.Multithreaded;
+        m_Deterministic = config.Deterministic;
+        m_FixedTimeStep = config.FixedTimeStep > 0.0f ? config.FixedTimeStep : 1.0f / 60.0f;
+        if (m_Deterministic && m_Multithreaded) {
+            // Island batching and pool solver choice depend on thread timing
+            Log::Warn("Deterministic physics is single-threaded, ignoring Multithreaded");
+            m_Multithreaded = false;
+        }
+#if BT_THREADSAFE
+        if (m_Multithreaded && btGetTaskScheduler() != &GetTaskScheduler()) {
+            Log::Warn("PhysicsWorld::InstallGlobalHooks() was not called, using the single-threaded physics world");
+            m_Multithreaded = false;
+        }
+        if (m_Multithreaded && !JobSystem::IsInitialized()) {
+            Log::Warn("The job system is not running, using the single-threaded physics world");
+            m_Multithreaded = false;
+        }
+        if (m_Multithreaded && JobSystem::GetWorkerCount() + 2 > BT_MAX_THREAD_COUNT) {
+            // Bullet has no per-thread slot for some workers
+            Log::Warn("More job workers than Bullet's BT_MAX_THREAD_COUNT, using the single-threaded physics world");
+            m_Multithreaded = false;
+        }
+#else
+        if (m_Multithreaded) {
+            Log::Warn("Bullet was built without BT_THREADSAFE, using the single-threaded physics world");
+            m_Multithreaded = false;
+        }
+#endif
         
         // Broadphase
-        m_Broadphase = std::make_unique<btDbvtBroadphase>();
+        m_Broadphase = std::make_unique<TimedBroadphase>(m_BroadphaseNanoseconds);
         
-        // Solver
-        m_Solver = std::make_unique<btSequentialImpulseConstraintSolver>();
+#if BT_THREADSAFE
+        if (m_Multithreaded) {
+            // Contact points and algorithms come from pools shared by all threads;
+            // size them for large piles so they do not fall back to the heap
+            btDefaultCollisionConstructionInfo constructionInfo;
+            constructionInfo.m_defaultMaxPersistentManifoldPoolSize = 80000;
+            constructionInfo.m_defaultMaxCollisionAlgorithmPoolSize = 80000;
+            m_CollisionConfiguration = std::make_unique<btDefaultCollisionConfiguration>(constructionInfo);
+            m_Dispatcher = std::make_unique<TimedDispatcher<btCollisionDispatcherMt>>(
+                m_NarrowphaseNanoseconds, m_CollisionConfiguration.get());
+            
+            // One solver per thread for small islands, plus a parallel solver
+            // for islands too large to solve alone
+            auto solverPool = std::make_unique<TimedSolver<btConstraintSolverPoolMt>>(
+                m_SolverNanoseconds, m_SolverGroups, GetTaskScheduler().getNumThreads());
+            m_SolverMt = std::make_unique<TimedSolver<btSequentialImpulseConstraintSolverMt>>(
+                m_SolverNanoseconds, m_SolverGroups);
+            
+            m_DynamicsWorld = std::make_unique<btDiscreteDynamicsWorldMt>(
+                m_Dispatcher.get(),
+                m_Broadphase.get(),
+                solverPool.get(),
+                m_SolverMt.get(),
+                m_CollisionConfiguration.get()
+            );
+            m_Solver = std::move(solverPool);
+        }
+#endif
         
-        // Dynamics world
-        m_DynamicsWorld = std::make_unique<btDiscreteDynamicsWorld>(
-            m_Dispatcher.get(),
-            m_Broadphase.get(),
-            m_Solver.get(),
-            m_CollisionConfiguration.get()
-        );
+        if (!m_DynamicsWorld) {
+            m_CollisionConfiguration = std::make_unique<btDefaultCollisionConfiguration>();
+            m_Dispatcher = std::make_unique<TimedDispatcher<btCollisionDispatcher>>(
+                m_NarrowphaseNanoseconds, m_CollisionConfiguration.get());
+            m_Solver = std::make_unique<TimedSolver<btSequentialImpulseConstraintSolver>>(m_SolverNanoseconds, m_SolverGroups);
+            
+            m_DynamicsWorld = std::make_unique<btDiscreteDynamicsWorld>(
+                m_Dispatcher.get(),
+                m_Broadphase.get(),
+                m_Solver.get(),
+                m_CollisionConfiguration.get()
+            );
+        }
         
         // Set default gravity
-        m_DynamicsWorld->setGravity(btVector3(0, -9.81f, 0));
+        m_Gravity = btVector3(0, -9.81f, 0);
+        m_DynamicsWorld->setGravity(m_Gravity);
         
-        Log::Info("Physics world initialized");
+#if BT_BULLET_VERSION >= 287
+        if (m_Deterministic) {
+            // Sort overlapping pairs so contact order does not depend on broadphase history
+            m_DynamicsWorld->getDispatchInfo().m_deterministicOverlappingPairs = true;
+        }
+#endif
+        
+        Log::Info("Physics world initialized", m_Multithreaded ? " (multithreaded)" : "",
+                  m_Deterministic ? " (deterministic)" : "");
     }
     
     void PhysicsWorld::Update(float deltaTime) {
-        if (m_DynamicsWorld) {
-            m_DynamicsWorld->stepSimulation(deltaTime, 10);
+        if (!m_DynamicsWorld) {
+            return;
+        }
+        
+        uint32_t steps = 0;
+        if (m_Deterministic) {
+            // Frame time only decides how many steps run, never their length.
+            // Too far behind, the rest waits for later updates rather than
+            // spiral; dropping it would put the world behind its peers.
+            m_Accumulator += deltaTime;
+            while (m_Accumulator >= m_FixedTimeStep && steps < MaxStepsPerUpdate) {
+                m_Accumulator -= m_FixedTimeStep;
+                ++steps;
+            }
+            
+            bool behind = m_Accumulator >= m_FixedTimeStep;
+            if (behind && !m_FallingBehind) {
+                Log::Warn("Deterministic physics is falling behind, carrying ",
+                          static_cast<uint32_t>(m_Accumulator / m_FixedTimeStep), " steps over");
+            }
+            m_FallingBehind = behind;
+        }
+        Advance(deltaTime, steps);
+    }
+    
+    void PhysicsWorld::UpdateSteps(uint32_t steps) {
+        if (!m_DynamicsWorld) {
+            return;
+        }
+        
+        Advance(steps * m_FixedTimeStep, steps);
+    }
+    
+    void PhysicsWorld::Advance(float deltaTime, uint32_t steps) {
+        if (!m_Deterministic) {
+            steps = 0;
+        }
+        
+        if (m_Mode == PhysicsMode::Synchronous) {
+            AddPendingBodies();
+            m_StepCount += steps;
+            Step(deltaTime, steps);
+            PublishStep();
+            return;
+        }
+        
+        // Publish the step started last frame
+        WaitForStep();
+        if (m_StepUnpublished) {
+            PublishStep();
+            m_StepUnpublished = false;
         }
+        
+        // The physics thread is idle: safe to touch slots and buffers, and to
+        // query the world the published step left
+        AddPendingBodies();
+        RunPendingQueries();
+        
+        m_StepCount += steps;
+        {
+            std::lock_guard<std::mutex> lock(m_StepMutex);
+            m_StepDeltaTime = deltaTime;
+            m_StepSteps = steps;
+            m_StepRequested = true;
+            m_StepInFlight = true;
+        }
+        m_StepUnpublished = true;
+        m_StepCondition.notify_all();
     }
     
     void PhysicsWorld::Shutdown() {
-        m_RigidBodies.clear();
+        StopPhysicsThread();
+        m_Mode = PhysicsMode::Synchronous;
+        m_Commands.clear();
+        m_StepCommands.clear();
+        m_PendingQueries.clear();
+        
+        for (RigidBody* body : m_SlotBodies) {
+            if (!body) {
+                continue;
+            }
+            body->m_World = nullptr;
+            body->m_TransformSlot = InvalidSlot;
+        }
+        for (RigidBody* body : m_PendingBodies) {
+            body->m_World = nullptr;
+        }
+        
+        m_PendingBodies.clear();
+        m_SlotBodies.clear();
+        m_FreeSlots.clear();
+        m_Transforms[0].clear();
+        m_Transforms[1].clear();
+        m_MovedSlots[0].clear();
+        m_MovedSlots[1].clear();
+        
         m_DynamicsWorld.reset();
+        m_Gravity = btVector3(0, 0, 0);
         m_Solver.reset();
+        m_SolverMt.reset();
         m_Broadphase.reset();
         m_Dispatcher.reset();
         m_CollisionConfiguration.reset();
@@ -55,39 +397,351 @@ namespace YUGA {
         Log::Info("Physics world shutdown");
     }
     
-    void PhysicsWorld::SetGravity(const btVector3& gravity) {
-        if (m_DynamicsWorld) {
-            m_DynamicsWorld->setGravity(gravity);
+    void PhysicsWorld::SetMode(PhysicsMode mode) {
+        if (mode == m_Mode) {
+            return;
+        }
+        
+        if (mode == PhysicsMode::Asynchronous) {
+            m_ExitThread = false;
+            m_Mode = mode;
+            m_Thread = std::thread(&PhysicsWorld::PhysicsThreadLoop, this);
+        } else {
+            StopPhysicsThread();
+            if (m_StepUnpublished) {
+                PublishStep();
+                m_StepUnpublished = false;
+            }
+            m_Mode = mode;
+            FlushCommands();
+            RunPendingQueries();
+        }
+    }
+    
+    void PhysicsWorld::WaitForStep() {
+        std::unique_lock<std::mutex> lock(m_StepMutex);
+        m_StepCondition.wait(lock, [this] { return !m_StepInFlight; });
+    }
+    
+    void PhysicsWorld::QueueCommand(std::function<void()> command) {
+        if (m_Mode == PhysicsMode::Synchronous) {
+            command();
+            return;
+        }
+        
+        std::lock_guard<std::mutex> lock(m_CommandMutex);
+        m_Commands.push_back(std::move(command));
+    }
+    
+    void PhysicsWorld::QueueCommand(uint64_t step, std::function<void()> command) {
+        if (!m_Deterministic) {
+            QueueCommand(std::move(command));
+            return;
+        }
+        
+        if (step <= m_StepCount) {
+            Log::Warn("Physics command for step ", step, " queued after it started, running it at step ", m_StepCount + 1);
+            step = m_StepCount + 1;
+        }
+        
+        std::lock_guard<std::mutex> lock(m_CommandMutex);
+        m_StepCommands.push_back({ step, std::move(command) });
+    }
+    
+    void PhysicsWorld::FlushCommands() {
+        std::vector<std::function<void()>> commands;
+        {
+            std::lock_guard<std::mutex> lock(m_CommandMutex);
+            commands.swap(m_Commands);
+        }
+        
+        for (auto& command : commands) {
+            command();
+        }
+    }
+    
+    void PhysicsWorld::PublishStep() {
+        m_ReadIndex = 1 - m_ReadIndex;
+        
+        // The new back buffer is two steps old: bring forward the slots the
+        // published step moved so untouched slots stay current
+        int writeIndex = 1 - m_ReadIndex;
+        for (uint32_t slot : m_MovedSlots[m_ReadIndex]) {
+            m_Transforms[writeIndex][slot] = m_Transforms[m_ReadIndex][slot];
+        }
+        m_MovedSlots[writeIndex].clear();
+    }
+    
+    void PhysicsWorld::Step(float deltaTime, uint32_t steps) {
+        FlushCommands();
+        
+        m_BroadphaseNanoseconds = 0;
+        m_NarrowphaseNanoseconds = 0;
+        m_SolverNanoseconds.store(0, std::memory_order_relaxed);
+        m_SolverGroups.store(0, std::memory_order_relaxed);
+        auto start = std::chrono::steady_clock::now();
+        
+        if (m_Deterministic) {
+            StepFixed(steps);
+        } else {
+            m_DynamicsWorld->stepSimulation(deltaTime, 10);
+        }
+        
+        std::chrono::duration<float, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        GatherStats(elapsed.count());
+    }
+    
+    void PhysicsWorld::StepFixed(uint32_t steps) {
+        int writeIndex = 1 - m_ReadIndex;
+        m_StepHashes[writeIndex].clear();
+        
+        // m_StepCount already counts these steps; the main thread leaves it
+        // alone until they finish
+        uint64_t firstStep = m_StepCount - steps + 1;
+        
+        // Take the commands keyed to these steps, in step then queue order
+        std::vector<StepCommand> commands;
+        {
+            std::lock_guard<std::mutex> lock(m_CommandMutex);
+            auto due = std::stable_partition(m_StepCommands.begin(), m_StepCommands.end(),
+                [last = m_StepCount](const StepCommand& command) { return command.Step > last; });
+            commands.assign(std::make_move_iterator(due), std::make_move_iterator(m_StepCommands.end()));
+            m_StepCommands.erase(due, m_StepCommands.end());
+        }
+        std::stable_sort(commands.begin(), commands.end(), [](const StepCommand& a, const StepCommand& b) {
+            return a.Step < b.Step;
+        });
+        
+        size_t nextCommand = 0;
+        for (uint64_t step = firstStep; step <= m_StepCount; ++step) {
+            for (; nextCommand < commands.size() && commands[nextCommand].Step <= step; ++nextCommand) {
+                commands[nextCommand].Command();
+            }
+            
+            // maxSubSteps 0: exactly one step of the given length, no
+            // interpolation and no internal accumulator
+            m_DynamicsWorld->stepSimulation(m_FixedTimeStep, 0);
+            m_StepHashes[writeIndex].push_back({ step, HashState() });
+        }
+        
+        // Each step wrote back the bodies it moved
+        if (steps > 1) {
+            std::vector<uint32_t>& moved = m_MovedSlots[writeIndex];
+            std::sort(moved.begin(), moved.end());
+            moved.erase(std::unique(moved.begin(), moved.end()), moved.end());
+        }
+    }
+    
+    uint64_t PhysicsWorld::HashState() const {
+        // Per-body FNV-1a over the exact bits of the body's state, summed so
+        // the result does not depend on slot or world array order
+        uint64_t hash = 0;
+        for (const RigidBody* body : m_SlotBodies) {
+            if (!body) {
+                continue;
+            }
+            
+            const btRigidBody* bulletBody = body->GetBulletBody();
+            const btTransform& transform = bulletBody->getWorldTransform();
+            btQuaternion rotation = transform.getRotation();
+            const btVector3& origin = transform.getOrigin();
+            const btVector3& linear = bulletBody->getLinearVelocity();
+            const btVector3& angular = bulletBody->getAngularVelocity();
+            
+            float values[] = {
+                origin.x(), origin.y(), origin.z(),
+                rotation.x(), rotation.y(), rotation.z(), rotation.w(),
+                linear.x(), linear.y(), linear.z(),
+                angular.x(), angular.y(), angular.z()
+            };
+            
+            uint64_t bodyHash = 0xcbf29ce484222325ull;
+            bodyHash = (bodyHash ^ static_cast<uint32_t>(bulletBody->getUserIndex())) * 0x100000001b3ull;
+            for (float value : values) {
+                uint32_t bits;
+                std::memcpy(&bits, &value, sizeof(bits));
+                bodyHash = (bodyHash ^ bits) * 0x100000001b3ull;
+            }
+            hash += bodyHash;
+        }
+        return hash;
+    }
+    
+    void PhysicsWorld::GatherStats(float stepMilliseconds) {
+        PhysicsStats& stats = m_Stats[1 - m_ReadIndex];
+        stats = PhysicsStats();
+        stats.StepMilliseconds = stepMilliseconds;
+        stats.BroadphaseMilliseconds = m_BroadphaseNanoseconds * 1e-6f;
+        stats.NarrowphaseMilliseconds = m_NarrowphaseNanoseconds * 1e-6f;
+        stats.SolverMilliseconds = m_SolverNanoseconds.load(std::memory_order_relaxed) * 1e-6f;
+        stats.SolverGroups = m_SolverGroups.load(std::memory_order_relaxed);
+#if BT_THREADSAFE
+        stats.Threads = m_Multithreaded ? static_cast<uint32_t>(btGetTaskScheduler()->getNumThreads()) : 1;
+#endif
+        stats.Constraints = static_cast<uint32_t>(m_DynamicsWorld->getNumConstraints());
+        
+        stats.Manifolds = static_cast<uint32_t>(m_Dispatcher->getNumManifolds());
+        for (int i = 0; i < m_Dispatcher->getNumManifolds(); ++i) {
+            stats.ContactPoints += m_Dispatcher->getManifoldByIndexInternal(i)->getNumContacts();
+        }
+        
+        // Island tags index the collision object array; -1 for static objects
+        const btCollisionObjectArray& objects = m_DynamicsWorld->getCollisionObjectArray();
+        m_IslandSizes.assign(objects.size(), 0);
+        for (int i = 0; i < objects.size(); ++i) {
+            const btCollisionObject* object = objects[i];
+            int island = object->getIslandTag();
+            if (!object->isActive() || object->isStaticOrKinematicObject() || island < 0 || island >= objects.size()) {
+                continue;
+            }
+            ++stats.ActiveBodies;
+            if (m_IslandSizes[island]++ == 0) {
+                ++stats.ActiveIslands;
+            }
+            stats.LargestIsland = std::max(stats.LargestIsland, m_IslandSizes[island]);
+        }
+    }
+    
+    void PhysicsWorld::RecordTransform(uint32_t slot, const btTransform& transform) {
+        // Called from motion states while stepping: Bullet only writes back
+        // active, non-static bodies
+        int writeIndex = 1 - m_ReadIndex;
+        const btVector3& origin = transform.getOrigin();
+        btQuaternion rotation = transform.getRotation();
+        
+        PhysicsTransform& target = m_Transforms[writeIndex][slot];
+        target.Position = Vector3(origin.x(), origin.y(), origin.z());
+        target.Rotation = Quaternion(rotation.x(), rotation.y(), rotation.z(), rotation.w());
+        m_MovedSlots[writeIndex].push_back(slot);
+    }
+    
+    void PhysicsWorld::PhysicsThreadLoop() {
+        while (true) {
+            float deltaTime;
+            uint32_t steps;
+            {
+                std::unique_lock<std::mutex> lock(m_StepMutex);
+                m_StepCondition.wait(lock, [this] { return m_StepRequested || m_ExitThread; });
+                if (!m_StepRequested) {
+                    return;
+                }
+                m_StepRequested = false;
+                deltaTime = m_StepDeltaTime;
+                steps = m_StepSteps;
+            }
+            
+            Step(deltaTime, steps);
+            
+            {
+                std::lock_guard<std::mutex> lock(m_StepMutex);
+                m_StepInFlight = false;
+            }
+            m_StepCondition.notify_all();
+        }
+    }
+    
+    void PhysicsWorld::StopPhysicsThread() {
+        if (!m_Thread.joinable()) {
+            return;
         }
+        
+        {
+            std::lock_guard<std::mutex> lock(m_StepMutex);
+            m_ExitThread = true;
+        }
+        m_StepCondition.notify_all();
+        m_Thread.join();
     }
     
-    btVector3 PhysicsWorld::GetGravity() const {
+    void PhysicsWorld::SetGravity(const btVector3& gravity) {
         if (m_DynamicsWorld) {
-            return m_DynamicsWorld->getGravity();
+            m_Gravity = gravity;
+            QueueCommand([this, gravity] { m_DynamicsWorld->setGravity(gravity); });
         }
-        return btVector3(0, 0, 0);
     }
     
     void PhysicsWorld::AddRigidBody(RigidBody* body) {
-        if (body && m_DynamicsWorld) {
+        if (!body || !m_DynamicsWorld) {
+            return;
+        }
+        
+        // Asynchronous: the body joins the world at the next Update(). So do
+        // deterministic bodies, to be added as a batch in entity order.
+        body->m_World = this;
+        m_PendingBodies.push_back(body);
+        if (m_Mode == PhysicsMode::Synchronous && !m_Deterministic) {
+            AddPendingBodies();
+        }
+    }
+    
+    void PhysicsWorld::AddPendingBodies() {
+        if (m_Deterministic) {
+            // Bullet's results depend on the order bodies enter the world
+            std::stable_sort(m_PendingBodies.begin(), m_PendingBodies.end(), [](RigidBody* a, RigidBody* b) {
+                return static_cast<uint32_t>(a->GetBulletBody()->getUserIndex()) <
+                       static_cast<uint32_t>(b->GetBulletBody()->getUserIndex());
+            });
+        }
+        
+        for (RigidBody* body : m_PendingBodies) {
+            uint32_t slot;
+            if (!m_FreeSlots.empty()) {
+                slot = m_FreeSlots.back();
+                m_FreeSlots.pop_back();
+            } else {
+                slot = static_cast<uint32_t>(m_SlotBodies.size());
+                m_SlotBodies.push_back(nullptr);
+                m_Transforms[0].emplace_back();
+                m_Transforms[1].emplace_back();
+            }
+            
+            // Seed both buffers so reads are valid before the first step
+            PhysicsTransform initial;
+            initial.Position = body->GetPosition();
+            btQuaternion rotation = body->GetRotation();
+            initial.Rotation = Quaternion(rotation.x(), rotation.y(), rotation.z(), rotation.w());
+            m_Transforms[0][slot] = initial;
+            m_Transforms[1][slot] = initial;
+            
+            m_SlotBodies[slot] = body;
+            body->m_TransformSlot = slot;
+            
             m_DynamicsWorld->addRigidBody(body->GetBulletBody());
-            m_RigidBodies.push_back(body);
         }
+        m_PendingBodies.clear();
     }
     
     void PhysicsWorld::RemoveRigidBody(RigidBody* body) {
-        if (body && m_DynamicsWorld) {
-            m_DynamicsWorld->removeRigidBody(body->GetBulletBody());
-            auto it = std::find(m_RigidBodies.begin(), m_RigidBodies.end(), body);
-            if (it != m_RigidBodies.end()) {
-                m_RigidBodies.erase(it);
-            }
+        if (!body || !m_DynamicsWorld || body->m_World != this) {
+            return;
+        }
+        
+        if (body->m_TransformSlot == InvalidSlot) {
+            // Still waiting for the next Update()
+            m_PendingBodies.erase(std::find(m_PendingBodies.begin(), m_PendingBodies.end(), body));
+            body->m_World = nullptr;
+            return;
         }
+        
+        // Let the in-flight step finish and apply commands that may still
+        // reference the body while it is alive
+        WaitForStep();
+        FlushCommands();
+        
+        m_DynamicsWorld->removeRigidBody(body->GetBulletBody());
+        
+        m_SlotBodies[body->m_TransformSlot] = nullptr;
+        m_FreeSlots.push_back(body->m_TransformSlot);
+        body->m_TransformSlot = InvalidSlot;
+        body->m_World = nullptr;
     }
     
     bool PhysicsWorld::Raycast(const btVector3& from, const btVector3& to, btVector3& hitPoint) {
         if (!m_DynamicsWorld) return false;
         
+        // The world cannot be queried while the physics thread steps it
+        WaitForStep();
+        
         btCollisionWorld::ClosestRayResultCallback rayCallback(from, to);
         m_DynamicsWorld->rayTest(from, to, rayCallback);
         
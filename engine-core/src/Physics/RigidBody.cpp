@@ -1,117 +1,134 @@
 #include "Physics/RigidBody.h"
-#include "Core/Log.h"
 
 namespace YUGA {
     
-    RigidBody::RigidBody(CollisionShape shape, float mass)
-        : m_ShapeType(shape), m_Mass(mass), m_IsKinematic(false) {
+    void RigidBodyMotionState::setWorldTransform(const btTransform& transform) {
+        btDefaultMotionState::setWorldTransform(transform);
         
-        CreateCollisionShape(shape);
-        
-        // Calculate inertia
-        btVector3 localInertia(0, 0, 0);
-        if (mass != 0.0f) {
-            m_CollisionShape->calculateLocalInertia(mass, localInertia);
+        PhysicsWorld* world = m_Body.GetWorld();
+        uint32_t slot = m_Body.GetTransformSlot();
+        if (world && slot != PhysicsWorld::InvalidSlot) {
+            world->RecordTransform(slot, transform);
         }
-        
-        // Create motion state
-        btTransform startTransform;
-        startTransform.setIdentity();
-        startTransform.setOrigin(btVector3(0, 0, 0));
-        m_MotionState = std::make_unique<btDefaultMotionState>(startTransform);
-        
-        // Create rigid body
-        btRigidBody::btRigidBodyConstructionInfo rbInfo(mass, m_MotionState.get(), m_CollisionShape.get(), localInertia);
-        m_RigidBody = std::make_unique<btRigidBody>(rbInfo);
-        
-        Log::Info("RigidBody created");
+    }
+    
+    RigidBody::RigidBody(CollisionShape shape, float mass, const Vector3& size)
+        : RigidBody(CollisionShapeCache::Get().GetPrimitive(shape, size), mass) {
+    }
+    
+    RigidBody::RigidBody(CollisionShapeRef shape, float mass)
+        : m_Shape(std::move(shape)), m_Mass(mass), m_IsKinematic(false),
+          m_MotionState(*this, btTransform::getIdentity()),
+          m_RigidBody(MakeConstructionInfo(mass, &m_MotionState, m_Shape->GetShape())) {
     }
     
     RigidBody::~RigidBody() {
-        m_RigidBody.reset();
-        m_MotionState.reset();
-        m_CollisionShape.reset();
+        if (m_World) {
+            m_World->RemoveRigidBody(this);
+        }
     }
     
-    void RigidBody::CreateCollisionShape(CollisionShape shape) {
-        switch (shape) {
-            case CollisionShape::Box:
-                m_CollisionShape = std::make_unique<btBoxShape>(btVector3(0.5f, 0.5f, 0.5f));
-                break;
-            case CollisionShape::Sphere:
-                m_CollisionShape = std::make_unique<btSphereShape>(0.5f);
-                break;
-            case CollisionShape::Capsule:
-                m_CollisionShape = std::make_unique<btCapsuleShape>(0.5f, 1.0f);
-                break;
-            case CollisionShape::Mesh:
-                // For mesh, we'd need actual mesh data
-                m_CollisionShape = std::make_unique<btBoxShape>(btVector3(0.5f, 0.5f, 0.5f));
-                Log::Warn("Mesh collision shape not fully implemented, using box");
-                break;
+    btRigidBody::btRigidBodyConstructionInfo RigidBody::MakeConstructionInfo(
+        float mass, RigidBodyMotionState* motionState, btCollisionShape* shape) {
+        
+        btVector3 localInertia(0, 0, 0);
+        if (mass != 0.0f) {
+            shape->calculateLocalInertia(mass, localInertia);
         }
+        return btRigidBody::btRigidBodyConstructionInfo(mass, motionState, shape, localInertia);
+    }
+    
+    bool RigidBody::ReadsPublishedTransform() const {
+        return m_World && m_World->IsAsync() && m_TransformSlot != PhysicsWorld::InvalidSlot;
     }
     
     void RigidBody::SetPosition(const Vector3& position) {
-        btTransform transform;
-        m_RigidBody->getMotionState()->getWorldTransform(transform);
-        transform.setOrigin(btVector3(position.x, position.y, position.z));
-        m_RigidBody->setWorldTransform(transform);
-        m_RigidBody->getMotionState()->setWorldTransform(transform);
+        Modify([this, position] {
+            btTransform transform;
+            m_RigidBody.getMotionState()->getWorldTransform(transform);
+            transform.setOrigin(btVector3(position.x, position.y, position.z));
+            m_RigidBody.setWorldTransform(transform);
+            m_RigidBody.getMotionState()->setWorldTransform(transform);
+        });
     }
     
     Vector3 RigidBody::GetPosition() const {
+        if (ReadsPublishedTransform()) {
+            return m_World->GetTransform(m_TransformSlot).Position;
+        }
+        
         btTransform transform;
-        m_RigidBody->getMotionState()->getWorldTransform(transform);
+        m_RigidBody.getMotionState()->getWorldTransform(transform);
         btVector3 origin = transform.getOrigin();
         return Vector3(origin.x(), origin.y(), origin.z());
     }
     
     void RigidBody::SetRotation(const btQuaternion& rotation) {
-        btTransform transform;
-        m_RigidBody->getMotionState()->getWorldTransform(transform);
-        transform.setRotation(rotation);
-        m_RigidBody->setWorldTransform(transform);
-        m_RigidBody->getMotionState()->setWorldTransform(transform);
+        Modify([this, rotation] {
+            btTransform transform;
+            m_RigidBody.getMotionState()->getWorldTransform(transform);
+            transform.setRotation(rotation);
+            m_RigidBody.setWorldTransform(transform);
+            m_RigidBody.getMotionState()->setWorldTransform(transform);
+        });
     }
     
     btQuaternion RigidBody::GetRotation() const {
+        if (ReadsPublishedTransform()) {
+            const Quaternion& rotation = m_World->GetTransform(m_TransformSlot).Rotation;
+            return btQuaternion(rotation.x, rotation.y, rotation.z, rotation.w);
+        }
+        
         btTransform transform;
-        m_RigidBody->getMotionState()->getWorldTransform(transform);
+        m_RigidBody.getMotionState()->getWorldTransform(transform);
         return transform.getRotation();
     }
     
     void RigidBody::ApplyForce(const Vector3& force) {
-        m_RigidBody->activate();
-        m_RigidBody->applyCentralForce(btVector3(force.x, force.y, force.z));
+        Modify([this, force] {
+            m_RigidBody.activate();
+            m_RigidBody.applyCentralForce(btVector3(force.x, force.y, force.z));
+        });
     }
     
     void RigidBody::ApplyImpulse(const Vector3& impulse) {
-        m_RigidBody->activate();
-        m_RigidBody->applyCentralImpulse(btVector3(impulse.x, impulse.y, impulse.z));
+        Modify([this, impulse] {
+            m_RigidBody.activate();
+            m_RigidBody.applyCentralImpulse(btVector3(impulse.x, impulse.y, impulse.z));
+        });
+    }
+    
+    void RigidBody::Activate() {
+        Modify([this] {
+            m_RigidBody.activate();
+        });
     }
     
     void RigidBody::SetMass(float mass) {
         m_Mass = mass;
         
-        btVector3 localInertia(0, 0, 0);
-        if (mass != 0.0f) {
-            m_CollisionShape->calculateLocalInertia(mass, localInertia);
-        }
-        
-        m_RigidBody->setMassProps(mass, localInertia);
+        Modify([this, mass] {
+            btVector3 localInertia(0, 0, 0);
+            if (mass != 0.0f) {
+                m_Shape->GetShape()->calculateLocalInertia(mass, localInertia);
+            }
+            
+            m_RigidBody.setMassProps(mass, localInertia);
+        });
     }
     
     void RigidBody::SetKinematic(bool kinematic) {
         m_IsKinematic = kinematic;
         
-        if (kinematic) {
-            m_RigidBody->setCollisionFlags(m_RigidBody->getCollisionFlags() | btCollisionObject::CF_KINEMATIC_OBJECT);
-            m_RigidBody->setActivationState(DISABLE_DEACTIVATION);
-        } else {
-            m_RigidBody->setCollisionFlags(m_RigidBody->getCollisionFlags() & ~btCollisionObject::CF_KINEMATIC_OBJECT);
-            m_RigidBody->forceActivationState(ACTIVE_TAG);
-        }
+        Modify([this, kinematic] {
+            if (kinematic) {
+                m_RigidBody.setCollisionFlags(m_RigidBody.getCollisionFlags() | btCollisionObject::CF_KINEMATIC_OBJECT);
+                m_RigidBody.setActivationState(DISABLE_DEACTIVATION);
+            } else {
+                m_RigidBody.setCollisionFlags(m_RigidBody.getCollisionFlags() & ~btCollisionObject::CF_KINEMATIC_OBJECT);
+                m_RigidBody.forceActivationState(ACTIVE_TAG);
+            }
+        });
     }
     
 } // namespace YUGA
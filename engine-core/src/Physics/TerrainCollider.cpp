@@ -0,0 +1,174 @@
+#include "Physics/TerrainCollider.h"
+#include "Physics/PhysicsWorld.h"
+#include "Physics/RigidBody.h"
+#include "Core/Log.h"
+#include <BulletCollision/CollisionShapes/btHeightfieldTerrainShape.h>
+#include <algorithm>
+
+namespace YUGA {
+    
+    namespace {
+        
+        constexpr int AcceleratorChunkSize = 16;
+        
+        class TerrainHeightfieldShape : public btHeightfieldTerrainShape {
+        public:
+            TerrainHeightfieldShape(const Terrain& terrain, float minHeight, float maxHeight)
+                // Up axis Y; Terrain splits quads along the same diagonal as Bullet's default
+                : btHeightfieldTerrainShape(terrain.GetWidth(), terrain.GetHeight(), terrain.GetHeightData(),
+                                            1.0f, minHeight, maxHeight, 1, PHY_FLOAT, false) {
+                setLocalScaling(btVector3(terrain.GetScale(), 1.0f, terrain.GetScale()));
+#if BT_BULLET_VERSION >= 289
+                buildAccelerator(AcceleratorChunkSize);
+#endif
+            }
+            
+            // Recomputes the raycast accelerator bounds of the chunks covering
+            // the cell range, like buildAccelerator() does for all of them
+            void UpdateAccelerator(int minX, int minZ, int maxX, int maxZ) {
+#if BT_BULLET_VERSION >= 289
+                if (m_vboundsGrid.size() == 0) {
+                    return;
+                }
+                
+                // A cell on a chunk edge belongs to the chunks on both sides
+                int chunkMinX = std::max((minX - 1) / m_vboundsChunkSize, 0);
+                int chunkMinZ = std::max((minZ - 1) / m_vboundsChunkSize, 0);
+                int chunkMaxX = std::min(maxX / m_vboundsChunkSize, m_vboundsGridWidth - 1);
+                int chunkMaxZ = std::min(maxZ / m_vboundsChunkSize, m_vboundsGridLength - 1);
+                
+                for (int cz = chunkMinZ; cz <= chunkMaxZ; ++cz) {
+                    for (int cx = chunkMinX; cx <= chunkMaxX; ++cx) {
+                        int x0 = cx * m_vboundsChunkSize;
+                        int z0 = cz * m_vboundsChunkSize;
+                        int x1 = std::min(x0 + m_vboundsChunkSize, m_heightStickWidth - 1);
+                        int z1 = std::min(z0 + m_vboundsChunkSize, m_heightStickLength - 1);
+                        
+                        Range range;
+                        range.min = range.max = getRawHeightFieldValue(x0, z0);
+                        for (int z = z0; z <= z1; ++z) {
+                            for (int x = x0; x <= x1; ++x) {
+                                float value = getRawHeightFieldValue(x, z);
+                                range.min = std::min(range.min, value);
+                                range.max = std::max(range.max, value);
+                            }
+                        }
+                        m_vboundsGrid[cx + cz * m_vboundsGridWidth] = range;
+                    }
+                }
+#else
+                (void)minX; (void)minZ; (void)maxX; (void)maxZ;
+#endif
+            }
+        };
+        
+        // Wakes every body whose broadphase bounds touch a region
+        class WakeCallback : public btBroadphaseAabbCallback {
+        public:
+            explicit WakeCallback(const btCollisionObject* ignore) : m_Ignore(ignore) {}
+            
+            bool process(const btBroadphaseProxy* proxy) override {
+                const btCollisionObject* object = static_cast<const btCollisionObject*>(proxy->m_clientObject);
+                if (object != m_Ignore) {
+                    object->activate(true);
+                }
+                return true;
+            }
+            
+        private:
+            const btCollisionObject* m_Ignore;
+        };
+        
+    } // namespace
+    
+    TerrainCollider::TerrainCollider(Terrain& terrain, PhysicsWorld& world)
+        : m_Terrain(terrain), m_World(world) {
+        const float* heights = terrain.GetHeightData();
+        size_t count = static_cast<size_t>(terrain.GetWidth()) * terrain.GetHeight();
+        if (count == 0) {
+            YUGA_LOG_WARN("Terrain collider requested for an empty terrain");
+            return;
+        }
+        
+        auto [minHeight, maxHeight] = std::minmax_element(heights, heights + count);
+        CreateBody(*minHeight, *maxHeight);
+        terrain.SetListener(this);
+    }
+    
+    TerrainCollider::~TerrainCollider() {
+        m_Terrain.SetListener(nullptr);
+    }
+    
+    void TerrainCollider::CreateBody(float minHeight, float maxHeight) {
+        m_MinHeight = minHeight;
+        m_MaxHeight = maxHeight;
+        m_Scale = m_Terrain.GetScale();
+        
+        // Not registered with the cache: the shape reads this terrain's heights
+        CollisionShapeKey key{ CollisionShape::Heightfield,
+                               Vector3(static_cast<float>(m_Terrain.GetWidth()), static_cast<float>(m_Terrain.GetHeight()), m_Scale),
+                               reinterpret_cast<uintptr_t>(m_Terrain.GetHeightData()) };
+        CollisionShapeRef shape = CreateRef<SharedCollisionShape>(key,
+            std::make_unique<TerrainHeightfieldShape>(m_Terrain, minHeight, maxHeight));
+        
+        // Bullet centres the heightfield on its local origin
+        Ref<RigidBody> body = CreateRef<RigidBody>(std::move(shape), 0.0f);
+        body->SetPosition(Vector3((m_Terrain.GetWidth() - 1) * m_Scale * 0.5f,
+                                  (minHeight + maxHeight) * 0.5f,
+                                  (m_Terrain.GetHeight() - 1) * m_Scale * 0.5f));
+        
+        // Releasing the previous body removes it from the world
+        m_Body = std::move(body);
+        m_World.AddRigidBody(m_Body.get());
+    }
+    
+    void TerrainCollider::OnHeightsChanging(const Terrain&) {
+        // The physics thread reads the heights during a step
+        m_World.WaitForStep();
+    }
+    
+    void TerrainCollider::OnHeightsChanged(const Terrain& terrain, int minX, int minZ, int maxX, int maxZ) {
+        if (!m_Body) {
+            return;
+        }
+        
+        float regionMin = m_MinHeight;
+        float regionMax = m_MaxHeight;
+        const float* heights = terrain.GetHeightData();
+        for (int z = minZ; z <= maxZ; ++z) {
+            for (int x = minX; x <= maxX; ++x) {
+                float value = heights[z * terrain.GetWidth() + x];
+                regionMin = std::min(regionMin, value);
+                regionMax = std::max(regionMax, value);
+            }
+        }
+        
+        if (regionMin < m_MinHeight || regionMax > m_MaxHeight || terrain.GetScale() != m_Scale) {
+            // The height range is baked into the shape's bounds; leave headroom
+            // so sculpting does not rebuild it every stroke
+            float headroom = std::max((regionMax - regionMin) * 0.25f, 1.0f);
+            float minHeight = regionMin < m_MinHeight ? regionMin - headroom : m_MinHeight;
+            float maxHeight = regionMax > m_MaxHeight ? regionMax + headroom : m_MaxHeight;
+            CreateBody(minHeight, maxHeight);
+        } else {
+            static_cast<TerrainHeightfieldShape*>(m_Body->GetShape()->GetShape())->UpdateAccelerator(minX, minZ, maxX, maxZ);
+        }
+        
+        WakeRegion(minX, minZ, maxX, maxZ);
+    }
+    
+    void TerrainCollider::WakeRegion(int minX, int minZ, int maxX, int maxZ) {
+        // Triangles of the neighbouring cells moved too. The old heights are
+        // gone, so take the whole height range vertically.
+        btVector3 regionMin((minX - 1) * m_Scale, m_MinHeight, (minZ - 1) * m_Scale);
+        btVector3 regionMax((maxX + 1) * m_Scale, m_MaxHeight, (maxZ + 1) * m_Scale);
+        const btCollisionObject* terrainObject = m_Body->GetBulletBody();
+        
+        btDiscreteDynamicsWorld* world = m_World.GetWorld();
+        m_World.QueueCommand([world, regionMin, regionMax, terrainObject]() {
+            WakeCallback callback(terrainObject);
+            world->getBroadphase()->aabbTest(regionMin, regionMax, callback);
+        });
+    }
+    
+} // namespace YUGA
@@ -0,0 +1,136 @@
+#include "Physics/TriangleMeshCollider.h"
+#include "Assets/Model.h"
+#include "Core/Log.h"
+#include "Core/MappedFile.h"
+#include <filesystem>
+#include <fstream>
+#include <new>
+
+namespace YUGA {
+    
+    namespace {
+        
+        constexpr uint32_t BvhCacheMagic = 0x48564259;   // "YBVH"
+        constexpr uint32_t BvhCacheVersion = 1;
+        
+        // The serialized BVH is only valid for the same pointer and scalar size
+        constexpr uint32_t BvhCachePlatform = sizeof(void*) << 8 | sizeof(btScalar);
+        
+        // 16 bytes aligned so the BVH following it is aligned in the mapping
+        struct alignas(16) BvhCacheHeader {
+            uint32_t Magic;
+            uint32_t Version;
+            uint32_t Platform;
+            uint32_t BvhSize;
+            uint64_t ContentHash;
+        };
+        
+        // Geometry the shape points into; a base so it is built before the shape
+        struct TriangleMeshStorage {
+            explicit TriangleMeshStorage(const CollisionMesh& mesh)
+                : Positions(mesh.Positions.begin(), mesh.Positions.end()),
+                  Indices(mesh.Indices),
+                  MeshInterface(static_cast<int>(mesh.GetTriangleCount()), Indices.data(), 3 * sizeof(int),
+                                static_cast<int>(mesh.GetVertexCount()), Positions.data(), 3 * sizeof(btScalar)) {}
+            
+            std::vector<btScalar> Positions;
+            std::vector<int> Indices;
+            btTriangleIndexVertexArray MeshInterface;
+            MappedFile BvhFile;
+        };
+        
+        class TriangleMeshShape : private TriangleMeshStorage, public btBvhTriangleMeshShape {
+        public:
+            TriangleMeshShape(const CollisionMesh& mesh, bool buildBvh)
+                : TriangleMeshStorage(mesh), btBvhTriangleMeshShape(&MeshInterface, true, buildBvh) {}
+            
+            // bvh lives inside file, which the shape keeps mapped
+            void AdoptBvh(MappedFile file, btOptimizedBvh* bvh) {
+                BvhFile = std::move(file);
+                setOptimizedBvh(bvh);
+            }
+        };
+        
+        btOptimizedBvh* LoadBvh(const std::string& path, uint64_t contentHash, MappedFile& file) {
+            // Deserialization patches pointers in place: map privately so the
+            // untouched node pages stay shared with the file cache
+            if (!file.Open(path, MappedFile::Access::CopyOnWrite)) {
+                return nullptr;
+            }
+            
+            if (file.GetSize() < sizeof(BvhCacheHeader)) {
+                return nullptr;
+            }
+            
+            const BvhCacheHeader* header = static_cast<const BvhCacheHeader*>(file.GetData());
+            if (header->Magic != BvhCacheMagic || header->Version != BvhCacheVersion ||
+                header->Platform != BvhCachePlatform || header->ContentHash != contentHash ||
+                file.GetSize() < sizeof(BvhCacheHeader) + header->BvhSize) {
+                file.Close();
+                return nullptr;
+            }
+            
+            void* data = static_cast<uint8_t*>(file.GetData()) + sizeof(BvhCacheHeader);
+            return btOptimizedBvh::deSerializeInPlace(data, header->BvhSize, false);
+        }
+        
+        void SaveBvh(const std::string& path, uint64_t contentHash, const btOptimizedBvh& bvh) {
+            uint32_t size = bvh.calculateSerializeBufferSize();
+            
+            // serializeInPlace needs a 16 byte aligned buffer
+            constexpr std::align_val_t alignment{ 16 };
+            void* buffer = ::operator new(size, alignment);
+            bool serialized = bvh.serializeInPlace(buffer, size, false);
+            
+            if (serialized) {
+                BvhCacheHeader header{ BvhCacheMagic, BvhCacheVersion, BvhCachePlatform, size, contentHash };
+                
+                // Write to a temporary file so a crash never leaves a torn cache
+                std::string tempPath = path + ".tmp";
+                std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+                file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+                file.write(static_cast<const char*>(buffer), size);
+                file.close();
+                
+                std::error_code error;
+                if (file) {
+                    std::filesystem::rename(tempPath, path, error);
+                }
+                if (!file || error) {
+                    std::filesystem::remove(tempPath, error);
+                    YUGA_LOG_WARN("Failed to write collision BVH cache: ", path);
+                }
+            }
+            
+            ::operator delete(buffer, alignment);
+        }
+        
+    } // namespace
+    
+    CollisionShapeRef TriangleMeshCollider::Create(const CollisionMesh& mesh, const std::string& bvhCachePath) {
+        if (mesh.IsEmpty()) {
+            YUGA_LOG_WARN("Triangle mesh collider requested for an empty mesh");
+            return nullptr;
+        }
+        
+        return CollisionShapeCache::Get().GetMesh(CollisionShape::Mesh, mesh.ContentHash,
+            [&]() -> std::unique_ptr<btCollisionShape> {
+                MappedFile file;
+                btOptimizedBvh* cached = bvhCachePath.empty() ? nullptr : LoadBvh(bvhCachePath, mesh.ContentHash, file);
+                
+                auto shape = std::make_unique<TriangleMeshShape>(mesh, cached == nullptr);
+                if (cached) {
+                    shape->AdoptBvh(std::move(file), cached);
+                } else if (!bvhCachePath.empty()) {
+                    SaveBvh(bvhCachePath, mesh.ContentHash, *shape->getOptimizedBvh());
+                }
+                return shape;
+            });
+    }
+    
+    CollisionShapeRef TriangleMeshCollider::CreateForModel(const Model& model) {
+        std::string cachePath = model.GetPath().empty() ? std::string() : GetCachePath(model.GetPath());
+        return Create(CollisionMesh::FromModel(model), cachePath);
+    }
+    
+} // namespace YUGA
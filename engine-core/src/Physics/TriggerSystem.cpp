@@ -0,0 +1,204 @@
+#include "Physics/TriggerSystem.h"
+#include "ECS/Components.h"
+#include "Core/EventBus.h"
+#include "Math/Quaternion.h"
+#include <algorithm>
+#include <cmath>
+#include <memory>
+
+namespace YUGA {
+    
+    namespace {
+        
+        bool Equal(const Vector3& a, const Vector3& b) {
+            return a.x == b.x && a.y == b.y && a.z == b.z;
+        }
+        
+        uint32_t ToEntityId(entt::entity entity) {
+            return static_cast<uint32_t>(entt::to_integral(entity));
+        }
+        
+        bool IsTriggerVolume(const ColliderComponent* collider, const RigidBodyComponent* rigidBody) {
+            return collider && collider->IsTrigger && !rigidBody &&
+                   (collider->ColliderShape == ColliderComponent::Shape::Box ||
+                    collider->ColliderShape == ColliderComponent::Shape::Sphere);
+        }
+        
+        bool IsMover(const ColliderComponent* collider, const RigidBodyComponent* rigidBody) {
+            // Static bodies never move into or out of a trigger
+            return rigidBody && !(collider && collider->IsTrigger) &&
+                   (rigidBody->IsKinematic || rigidBody->Mass != 0.0f);
+        }
+        
+        // Collider center in world space
+        Vector3 GetCenter(const TransformComponent& transform, const ColliderComponent* collider,
+                          const Quaternion& rotation) {
+            if (!collider) {
+                return transform.Position;
+            }
+            return transform.Position + rotation.RotateVector(collider->Center * transform.Scale);
+        }
+        
+        float GetMoverRadius(const TransformComponent& transform, const ColliderComponent* collider) {
+            Vector3 size = collider ? collider->Size * transform.Scale : transform.Scale;
+            return 0.5f * std::max(std::abs(size.x), std::max(std::abs(size.y), std::abs(size.z)));
+        }
+        
+    } // namespace
+    
+    TriggerSystem::TriggerSystem(entt::registry& registry)
+        : m_Registry(registry) {
+        
+        m_Registry.on_construct<ColliderComponent>().connect<&TriggerSystem::OnEntityChanged>(this);
+        m_Registry.on_update<ColliderComponent>().connect<&TriggerSystem::OnEntityChanged>(this);
+        m_Registry.on_destroy<ColliderComponent>().connect<&TriggerSystem::OnEntityChanged>(this);
+        m_Registry.on_construct<RigidBodyComponent>().connect<&TriggerSystem::OnEntityChanged>(this);
+        m_Registry.on_update<RigidBodyComponent>().connect<&TriggerSystem::OnEntityChanged>(this);
+        m_Registry.on_destroy<RigidBodyComponent>().connect<&TriggerSystem::OnEntityChanged>(this);
+        
+        // Pick up entities that existed before the system
+        for (auto entity : m_Registry.view<ColliderComponent>()) {
+            m_PendingChanges.push_back(entity);
+        }
+        for (auto entity : m_Registry.view<RigidBodyComponent>()) {
+            m_PendingChanges.push_back(entity);
+        }
+    }
+    
+    TriggerSystem::~TriggerSystem() {
+        m_Registry.on_construct<ColliderComponent>().disconnect<&TriggerSystem::OnEntityChanged>(this);
+        m_Registry.on_update<ColliderComponent>().disconnect<&TriggerSystem::OnEntityChanged>(this);
+        m_Registry.on_destroy<ColliderComponent>().disconnect<&TriggerSystem::OnEntityChanged>(this);
+        m_Registry.on_construct<RigidBodyComponent>().disconnect<&TriggerSystem::OnEntityChanged>(this);
+        m_Registry.on_update<RigidBodyComponent>().disconnect<&TriggerSystem::OnEntityChanged>(this);
+        m_Registry.on_destroy<RigidBodyComponent>().disconnect<&TriggerSystem::OnEntityChanged>(this);
+        
+        m_Registry.clear<TriggerVolumeState>();
+        m_Registry.clear<TriggerMoverState>();
+    }
+    
+    void TriggerSystem::OnEntityChanged(entt::registry&, entt::entity entity) {
+        // Whether the entity is a trigger, a mover or neither may have
+        // changed: drop its proxies now and classify it again at the next update
+        RemoveProxies(entity);
+        m_PendingChanges.push_back(entity);
+    }
+    
+    void TriggerSystem::RemoveProxies(entt::entity entity) {
+        if (TriggerVolumeState* state = m_Registry.try_get<TriggerVolumeState>(entity)) {
+            m_World.RemoveTrigger(state->Trigger);
+            m_Registry.remove<TriggerVolumeState>(entity);
+        }
+        if (TriggerMoverState* state = m_Registry.try_get<TriggerMoverState>(entity)) {
+            m_World.RemoveMover(state->Mover);
+            m_Registry.remove<TriggerMoverState>(entity);
+        }
+    }
+    
+    void TriggerSystem::CreateProxies(entt::entity entity) {
+        if (!m_Registry.valid(entity) || m_Registry.any_of<TriggerVolumeState, TriggerMoverState>(entity)) {
+            return;
+        }
+        
+        const TransformComponent* transform = m_Registry.try_get<TransformComponent>(entity);
+        if (!transform) {
+            return;
+        }
+        
+        const ColliderComponent* collider = m_Registry.try_get<ColliderComponent>(entity);
+        const RigidBodyComponent* rigidBody = m_Registry.try_get<RigidBodyComponent>(entity);
+        Quaternion rotation = Quaternion::FromEulerAngles(transform->Rotation);
+        Vector3 center = GetCenter(*transform, collider, rotation);
+        
+        if (IsTriggerVolume(collider, rigidBody)) {
+            TriggerShape shape = collider->ColliderShape == ColliderComponent::Shape::Sphere
+                ? TriggerShape::Sphere : TriggerShape::Box;
+            TriggerVolumeState& state = m_Registry.emplace<TriggerVolumeState>(entity);
+            state.Trigger = m_World.AddTrigger(shape, collider->Size * transform->Scale, center, rotation, ToEntityId(entity));
+            state.SyncedPosition = transform->Position;
+            state.SyncedRotation = transform->Rotation;
+        } else if (IsMover(collider, rigidBody)) {
+            TriggerMoverState& state = m_Registry.emplace<TriggerMoverState>(entity);
+            state.Mover = m_World.AddMover(center, GetMoverRadius(*transform, collider), ToEntityId(entity));
+            state.SyncedPosition = transform->Position;
+            state.SyncedRotation = transform->Rotation;
+        }
+    }
+    
+    void TriggerSystem::ApplyPendingChanges() {
+        for (entt::entity entity : m_PendingChanges) {
+            CreateProxies(entity);
+        }
+        m_PendingChanges.clear();
+    }
+    
+    void TriggerSystem::SyncTransforms() {
+        // Static zones and pickups are skipped after a compare
+        auto triggers = m_Registry.view<TransformComponent, TriggerVolumeState>();
+        for (auto entity : triggers) {
+            auto& transform = triggers.get<TransformComponent>(entity);
+            auto& state = triggers.get<TriggerVolumeState>(entity);
+            if (Equal(transform.Position, state.SyncedPosition) && Equal(transform.Rotation, state.SyncedRotation)) {
+                continue;
+            }
+            
+            Quaternion rotation = Quaternion::FromEulerAngles(transform.Rotation);
+            const ColliderComponent* collider = m_Registry.try_get<ColliderComponent>(entity);
+            m_World.SetTriggerTransform(state.Trigger, GetCenter(transform, collider, rotation), rotation);
+            state.SyncedPosition = transform.Position;
+            state.SyncedRotation = transform.Rotation;
+        }
+        
+        auto movers = m_Registry.view<TransformComponent, TriggerMoverState>();
+        for (auto entity : movers) {
+            auto& transform = movers.get<TransformComponent>(entity);
+            auto& state = movers.get<TriggerMoverState>(entity);
+            if (Equal(transform.Position, state.SyncedPosition) && Equal(transform.Rotation, state.SyncedRotation)) {
+                continue;
+            }
+            
+            const ColliderComponent* collider = m_Registry.try_get<ColliderComponent>(entity);
+            Quaternion rotation = Quaternion::FromEulerAngles(transform.Rotation);
+            m_World.SetMoverPosition(state.Mover, GetCenter(transform, collider, rotation));
+            state.SyncedPosition = transform.Position;
+            state.SyncedRotation = transform.Rotation;
+        }
+    }
+    
+    void TriggerSystem::PublishEvents() {
+        const std::vector<TriggerEvent>& enters = m_World.GetEnterEvents();
+        const std::vector<TriggerEvent>& stays = m_World.GetStayEvents();
+        const std::vector<TriggerEvent>& exits = m_World.GetExitEvents();
+        
+        size_t count = enters.size() + stays.size() + exits.size();
+        if (count == 0) {
+            return;
+        }
+        
+        // One copy into the frame arena per update, not one event per pair
+        TriggerEvent* events = FrameArena::AllocateArray<TriggerEvent>(count);
+        if (events) {
+            TriggerEvent* out = std::uninitialized_copy(enters.begin(), enters.end(), events);
+            out = std::uninitialized_copy(stays.begin(), stays.end(), out);
+            std::uninitialized_copy(exits.begin(), exits.end(), out);
+        } else {
+            // Arena exhausted: keep the copy here instead, until the next
+            // Update(), which comes after this frame's dispatch
+            m_OverflowEvents.assign(enters.begin(), enters.end());
+            m_OverflowEvents.insert(m_OverflowEvents.end(), stays.begin(), stays.end());
+            m_OverflowEvents.insert(m_OverflowEvents.end(), exits.begin(), exits.end());
+            events = m_OverflowEvents.data();
+        }
+        
+        EventBus::Publish<TriggerEventBatch>(&m_World, events, static_cast<uint32_t>(enters.size()),
+                                             static_cast<uint32_t>(stays.size()), static_cast<uint32_t>(exits.size()));
+    }
+    
+    void TriggerSystem::Update() {
+        ApplyPendingChanges();
+        SyncTransforms();
+        m_World.Update();
+        PublishEvents();
+    }
+
+} // namespace YUGA
@@ -0,0 +1,306 @@
+#include "Physics/TriggerWorld.h"
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+
+namespace YUGA {
+    
+    namespace {
+        
+        uint64_t MakePairKey(TriggerHandle trigger, TriggerMoverHandle mover) {
+            return static_cast<uint64_t>(trigger.Value) << 32 | mover.Value;
+        }
+        
+        TriggerEvent MakeEvent(uint64_t key, uint32_t triggerEntity, uint32_t moverEntity) {
+            TriggerEvent event;
+            event.Trigger.Value = static_cast<uint32_t>(key >> 32);
+            event.Mover.Value = static_cast<uint32_t>(key);
+            event.TriggerEntity = triggerEntity;
+            event.MoverEntity = moverEntity;
+            return event;
+        }
+        
+        void UpdateBounds(TriggerVolume& trigger) {
+            Vector3 extent;
+            if (trigger.Shape == TriggerShape::Sphere) {
+                float radius = trigger.HalfExtents.x;
+                extent = Vector3(radius, radius, radius);
+            } else {
+                // Oriented box: project the half extents onto the world axes
+                const Vector3* axes = trigger.Axes;
+                const Vector3& h = trigger.HalfExtents;
+                extent.x = std::abs(axes[0].x) * h.x + std::abs(axes[1].x) * h.y + std::abs(axes[2].x) * h.z;
+                extent.y = std::abs(axes[0].y) * h.x + std::abs(axes[1].y) * h.y + std::abs(axes[2].y) * h.z;
+                extent.z = std::abs(axes[0].z) * h.x + std::abs(axes[1].z) * h.y + std::abs(axes[2].z) * h.z;
+            }
+            trigger.BoundsMin = trigger.Position - extent;
+            trigger.BoundsMax = trigger.Position + extent;
+        }
+        
+        void SetRotation(TriggerVolume& trigger, const Quaternion& rotation) {
+            trigger.Axes[0] = rotation.RotateVector(Vector3(1.0f, 0.0f, 0.0f));
+            trigger.Axes[1] = rotation.RotateVector(Vector3(0.0f, 1.0f, 0.0f));
+            trigger.Axes[2] = rotation.RotateVector(Vector3(0.0f, 0.0f, 1.0f));
+        }
+        
+    } // namespace
+    
+    TriggerHandle TriggerWorld::AddTrigger(TriggerShape shape, const Vector3& size, const Vector3& position,
+                                           const Quaternion& rotation, uint32_t entity) {
+        TriggerHandle handle = m_TriggerSlots.Allocate();
+        if (!handle) {
+            return {};
+        }
+        uint32_t slot = handle.GetIndex();
+        if (slot >= m_Triggers.size()) {
+            m_Triggers.resize(slot + 1);
+        }
+        
+        TriggerVolume& trigger = m_Triggers[slot];
+        trigger.Shape = shape;
+        trigger.Position = position;
+        trigger.HalfExtents = shape == TriggerShape::Sphere
+            ? Vector3(size.x * 0.5f, size.x * 0.5f, size.x * 0.5f)
+            : size * 0.5f;
+        SetRotation(trigger, rotation);
+        UpdateBounds(trigger);
+        trigger.Entity = entity;
+        
+        m_TriggerIntervals.push_back({ 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, slot, handle.GetGeneration() });
+        return handle;
+    }
+    
+    void TriggerWorld::SetTriggerTransform(TriggerHandle handle, const Vector3& position, const Quaternion& rotation) {
+        if (!m_TriggerSlots.Contains(handle)) {
+            return;
+        }
+        
+        TriggerVolume& trigger = m_Triggers[handle.GetIndex()];
+        trigger.Position = position;
+        SetRotation(trigger, rotation);
+        UpdateBounds(trigger);
+    }
+    
+    void TriggerWorld::RemoveTrigger(TriggerHandle handle) {
+        // Its interval goes stale; its pairs turn into exits on the next update
+        m_TriggerSlots.Free(handle);
+    }
+    
+    TriggerMoverHandle TriggerWorld::AddMover(const Vector3& position, float radius, uint32_t entity) {
+        TriggerMoverHandle handle = m_MoverSlots.Allocate();
+        if (!handle) {
+            return {};
+        }
+        uint32_t slot = handle.GetIndex();
+        if (slot >= m_Movers.size()) {
+            m_Movers.resize(slot + 1);
+        }
+        
+        TriggerMover& mover = m_Movers[slot];
+        mover.Position = position;
+        mover.Radius = radius;
+        mover.Entity = entity;
+        
+        m_MoverIntervals.push_back({ 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, slot, handle.GetGeneration() });
+        return handle;
+    }
+    
+    void TriggerWorld::SetMoverPosition(TriggerMoverHandle handle, const Vector3& position) {
+        if (!m_MoverSlots.Contains(handle)) {
+            return;
+        }
+        m_Movers[handle.GetIndex()].Position = position;
+    }
+    
+    void TriggerWorld::RemoveMover(TriggerMoverHandle handle) {
+        m_MoverSlots.Free(handle);
+    }
+    
+    void TriggerWorld::Clear() {
+        m_Triggers.clear();
+        m_Movers.clear();
+        m_TriggerSlots.Clear();
+        m_MoverSlots.Clear();
+        
+        m_TriggerIntervals.clear();
+        m_MoverIntervals.clear();
+        m_SortedTriggers = 0;
+        m_SortedMovers = 0;
+        
+        m_Pairs.clear();
+        m_Enters.clear();
+        m_Stays.clear();
+        m_Exits.clear();
+    }
+    
+    template<typename Slot>
+    void TriggerWorld::SortIntervals(std::vector<Interval>& intervals, size_t& sortedCount,
+                                     const std::vector<Slot>& slots, const HandleAllocator<Slot>& allocator) {
+        // Refresh the bounds and drop the intervals of freed slots, keeping
+        // the sorted prefix and the appended tail apart
+        size_t write = 0;
+        size_t keptSorted = 0;
+        for (size_t read = 0; read < intervals.size(); ++read) {
+            Interval interval = intervals[read];
+            if (allocator.GetGeneration(interval.Slot) != interval.Generation) {
+                continue;
+            }
+            
+            const Slot& slot = slots[interval.Slot];
+            Vector3 boundsMin;
+            Vector3 boundsMax;
+            if constexpr (std::is_same_v<Slot, TriggerVolume>) {
+                boundsMin = slot.BoundsMin;
+                boundsMax = slot.BoundsMax;
+            } else {
+                Vector3 extent(slot.Radius, slot.Radius, slot.Radius);
+                boundsMin = slot.Position - extent;
+                boundsMax = slot.Position + extent;
+            }
+            interval.Min = boundsMin.x;
+            interval.Max = boundsMax.x;
+            interval.MinY = boundsMin.y;
+            interval.MaxY = boundsMax.y;
+            interval.MinZ = boundsMin.z;
+            interval.MaxZ = boundsMax.z;
+            intervals[write++] = interval;
+            if (read < sortedCount) {
+                ++keptSorted;
+            }
+        }
+        intervals.resize(write);
+        
+        // Last update's order is nearly right when things move a little per
+        // frame, so insertion sort is close to linear there
+        auto first = intervals.begin();
+        auto middle = first + keptSorted;
+        for (auto it = first + 1; it < middle; ++it) {
+            Interval interval = *it;
+            auto hole = it;
+            while (hole > first && (hole - 1)->Min > interval.Min) {
+                *hole = *(hole - 1);
+                --hole;
+            }
+            *hole = interval;
+        }
+        
+        // New entries have no previous order
+        auto byMin = [](const Interval& a, const Interval& b) { return a.Min < b.Min; };
+        if (middle != intervals.end()) {
+            std::sort(middle, intervals.end(), byMin);
+            std::inplace_merge(first, middle, intervals.end(), byMin);
+        }
+        sortedCount = intervals.size();
+    }
+    
+    bool TriggerWorld::Overlaps(uint32_t triggerSlot, uint32_t moverSlot) const {
+        const TriggerVolume& trigger = m_Triggers[triggerSlot];
+        const TriggerMover& mover = m_Movers[moverSlot];
+        Vector3 offset = mover.Position - trigger.Position;
+        
+        if (trigger.Shape == TriggerShape::Sphere) {
+            float reach = trigger.HalfExtents.x + mover.Radius;
+            return offset.LengthSquared() <= reach * reach;
+        }
+        
+        // Distance from the sphere center to the closest point of the box
+        float distanceSquared = 0.0f;
+        const float* halfExtents = &trigger.HalfExtents.x;
+        for (int axis = 0; axis < 3; ++axis) {
+            float local = offset.Dot(trigger.Axes[axis]);
+            float excess = std::abs(local) - halfExtents[axis];
+            if (excess > 0.0f) {
+                distanceSquared += excess * excess;
+            }
+        }
+        return distanceSquared <= mover.Radius * mover.Radius;
+    }
+    
+    void TriggerWorld::FindOverlaps() {
+        m_NewPairs.clear();
+        
+        const std::vector<Interval>& triggers = m_TriggerIntervals;
+        const std::vector<Interval>& movers = m_MoverIntervals;
+        
+        // x is settled by the sweep. Non-short-circuit: most candidates fail
+        // on a coin flip of y or z, and a branch per test mispredicts
+        auto overlapYZ = [](const Interval& a, const Interval& b) {
+            return (a.MinY <= b.MaxY) & (b.MinY <= a.MaxY) & (a.MinZ <= b.MaxZ) & (b.MinZ <= a.MaxZ);
+        };
+        
+        auto addPair = [this](uint32_t triggerSlot, uint32_t moverSlot) {
+            if (!Overlaps(triggerSlot, moverSlot)) {
+                return;
+            }
+            TriggerHandle trigger = m_TriggerSlots.GetHandle(triggerSlot);
+            TriggerMoverHandle mover = m_MoverSlots.GetHandle(moverSlot);
+            m_NewPairs.push_back({ MakePairKey(trigger, mover), m_Triggers[triggerSlot].Entity, m_Movers[moverSlot].Entity });
+        };
+        
+        // Box pruning over the two lists, both sorted by min x: a pair is
+        // found from whichever interval starts first, scanning forward on
+        // the other side while intervals start before it ends. The scans
+        // read the interval arrays front to back
+        size_t runningMover = 0;
+        for (const Interval& trigger : triggers) {
+            while (runningMover < movers.size() && movers[runningMover].Min < trigger.Min) {
+                ++runningMover;
+            }
+            for (size_t i = runningMover; i < movers.size() && movers[i].Min <= trigger.Max; ++i) {
+                if (overlapYZ(trigger, movers[i])) {
+                    addPair(trigger.Slot, movers[i].Slot);
+                }
+            }
+        }
+        
+        size_t runningTrigger = 0;
+        for (const Interval& mover : movers) {
+            // Ties were taken by the trigger pass
+            while (runningTrigger < triggers.size() && triggers[runningTrigger].Min <= mover.Min) {
+                ++runningTrigger;
+            }
+            for (size_t i = runningTrigger; i < triggers.size() && triggers[i].Min <= mover.Max; ++i) {
+                if (overlapYZ(mover, triggers[i])) {
+                    addPair(triggers[i].Slot, mover.Slot);
+                }
+            }
+        }
+    }
+    
+    void TriggerWorld::DiffPairs() {
+        m_Enters.clear();
+        m_Stays.clear();
+        m_Exits.clear();
+        
+        std::sort(m_NewPairs.begin(), m_NewPairs.end(),
+            [](const Pair& a, const Pair& b) { return a.Key < b.Key; });
+        
+        // Merge against last update's pairs: only new is an enter, only old an exit
+        size_t oldIndex = 0;
+        size_t newIndex = 0;
+        while (oldIndex < m_Pairs.size() || newIndex < m_NewPairs.size()) {
+            if (newIndex >= m_NewPairs.size() ||
+                (oldIndex < m_Pairs.size() && m_Pairs[oldIndex].Key < m_NewPairs[newIndex].Key)) {
+                const Pair& pair = m_Pairs[oldIndex++];
+                m_Exits.push_back(MakeEvent(pair.Key, pair.TriggerEntity, pair.MoverEntity));
+            } else if (oldIndex >= m_Pairs.size() || m_NewPairs[newIndex].Key < m_Pairs[oldIndex].Key) {
+                const Pair& pair = m_NewPairs[newIndex++];
+                m_Enters.push_back(MakeEvent(pair.Key, pair.TriggerEntity, pair.MoverEntity));
+            } else {
+                const Pair& pair = m_NewPairs[newIndex++];
+                m_Stays.push_back(MakeEvent(pair.Key, pair.TriggerEntity, pair.MoverEntity));
+                ++oldIndex;
+            }
+        }
+        
+        m_Pairs.swap(m_NewPairs);
+    }
+    
+    void TriggerWorld::Update() {
+        SortIntervals(m_TriggerIntervals, m_SortedTriggers, m_Triggers, m_TriggerSlots);
+        SortIntervals(m_MoverIntervals, m_SortedMovers, m_Movers, m_MoverSlots);
+        FindOverlaps();
+        DiffPairs();
+    }
+
+} // namespace YUGA
@@ -0,0 +1,169 @@
+#include "Rendering/ParticleBudget.h"
+#include "Rendering/Camera.h"
+#include "Rendering/ParticleSystem.h"
+#include <algorithm>
+#include <cmath>
+
+namespace YUGA {
+
+namespace {
+
+float DistanceToBox(const Vector3& point, const Vector3& min, const Vector3& max) {
+    float dx = std::max(std::max(min.x - point.x, point.x - max.x), 0.0f);
+    float dy = std::max(std::max(min.y - point.y, point.y - max.y), 0.0f);
+    float dz = std::max(std::max(min.z - point.z, point.z - max.z), 0.0f);
+    return std::sqrt(dx * dx + dy * dy + dz * dz);
+}
+
+} // namespace
+
+void ParticleBudget::SetView(const Camera& camera) {
+    SetView(camera.GetViewProjectionMatrix(), camera.GetTransform().GetPosition());
+}
+
+void ParticleBudget::SetView(const Matrix4& viewProjection, const Vector3& position) {
+    frustum = Frustum::FromMatrix(viewProjection);
+    viewPosition = position;
+    hasView = true;
+}
+
+void ParticleBudget::Plan(std::vector<ParticleBudgetEntry>& entries, uint32_t liveParticles, float deltaTime) {
+    stats = {};
+    
+    for (ParticleBudgetEntry& entry : entries) {
+        ParticleSystem& emitter = *entry.emitter;
+        ParticleEmitterBudget& budget = *entry.budget;
+    
+        // Stopped and paused emitters do not run, so they owe nothing
+        if (!emitter.IsPlaying() || emitter.IsPaused()) {
+            budget = ParticleEmitterBudget();
+            continue;
+        }
+    
+        Classify(emitter, budget);
+        if (budget.distance > settings.lodStartDistance) {
+            ++stats.lodReducedEmitters;
+        }
+        budget.pendingTime = std::min(budget.pendingTime + deltaTime, settings.maxCatchUpTime);
+    
+        if (budget.visible) {
+            ++stats.visibleEmitters;
+        } else {
+            ++stats.offscreenEmitters;
+            ++budget.skippedFrames;
+        }
+    
+        bool due = budget.visible || (settings.offscreenUpdateInterval != 0 && budget.skippedFrames >= settings.offscreenUpdateInterval);
+        if (!due) {
+            budget.mode = ParticleUpdateMode::Skip;
+            budget.stepTime = 0.0f;
+            continue;
+        }
+    
+        // Time owed from skipped frames means a catch-up, even on re-entry
+        budget.mode = budget.pendingTime > deltaTime ? ParticleUpdateMode::CatchUp : ParticleUpdateMode::Normal;
+        budget.stepTime = budget.pendingTime;
+        budget.pendingTime = 0.0f;
+        budget.skippedFrames = 0;
+        if (budget.mode == ParticleUpdateMode::CatchUp) {
+            ++stats.catchUpEmitters;
+        }
+    }
+    
+    ApplyCap(entries, liveParticles);
+}
+
+void ParticleBudget::Classify(ParticleSystem& emitter, ParticleEmitterBudget& budget) const {
+    budget.visible = true;
+    budget.distance = 0.0f;
+    budget.emissionScale = 1.0f;
+    if (!hasView) {
+        return;
+    }
+    
+    // The particles' box, grown to the emitter so that new particles count
+    Vector3 position = emitter.GetTransform().GetPosition();
+    Vector3 min = position;
+    Vector3 max = position;
+    Vector3 particlesMin, particlesMax;
+    if (emitter.GetBounds(particlesMin, particlesMax)) {
+        min = Vector3(std::min(min.x, particlesMin.x), std::min(min.y, particlesMin.y), std::min(min.z, particlesMin.z));
+        max = Vector3(std::max(max.x, particlesMax.x), std::max(max.y, particlesMax.y), std::max(max.z, particlesMax.z));
+    }
+    Vector3 padding(0.5f * emitter.GetMaxParticleSize());
+    min = min - padding;
+    max = max + padding;
+    
+    budget.distance = DistanceToBox(viewPosition, min, max);
+    budget.visible = budget.distance <= settings.cullDistance && frustum.IntersectsBox(min, max);
+    
+    if (budget.distance > settings.lodStartDistance) {
+        float range = settings.lodEndDistance - settings.lodStartDistance;
+        float t = range > 0.0f ? std::min((budget.distance - settings.lodStartDistance) / range, 1.0f) : 1.0f;
+        budget.emissionScale = 1.0f + (settings.lodMinEmissionScale - 1.0f) * t;
+    }
+    if (!budget.visible) {
+        budget.emissionScale *= settings.offscreenEmissionScale;
+    }
+}
+
+void ParticleBudget::ApplyCap(std::vector<ParticleBudgetEntry>& entries, uint32_t liveParticles) {
+    if (settings.maxLiveParticles == std::numeric_limits<uint32_t>::max()) {
+        return;
+    }
+    
+    // Highest priority first, then nearest
+    order.clear();
+    for (uint32_t i = 0; i < entries.size(); ++i) {
+        if (entries[i].emitter->IsPlaying() && !entries[i].emitter->IsPaused()) {
+            order.push_back(i);
+        }
+    }
+    std::sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+        int priorityA = entries[a].emitter->GetSettings().priority;
+        int priorityB = entries[b].emitter->GetSettings().priority;
+        if (priorityA != priorityB) {
+            return priorityA > priorityB;
+        }
+        return entries[a].budget->distance < entries[b].budget->distance;
+    });
+    
+    // Share the cap out by the live count each emitter settles at, so
+    // lower priorities give way even while the cap is already full
+    float unclaimed = static_cast<float>(settings.maxLiveParticles);
+    for (uint32_t index : order) {
+        const ParticleEmitterSettings& emitterSettings = entries[index].emitter->GetSettings();
+        ParticleEmitterBudget& budget = *entries[index].budget;
+        float demand = std::min(emitterSettings.emissionRate * budget.emissionScale * emitterSettings.startLifetime,
+                                static_cast<float>(std::max(emitterSettings.maxParticles, 0)));
+        if (demand <= unclaimed) {
+            unclaimed -= demand;
+            continue;
+        }
+        
+        budget.emissionScale *= unclaimed / demand;
+        unclaimed = 0.0f;
+        ++stats.throttledEmitters;
+    }
+    
+    // Never emit past the cap this update. Particles dying this update are
+    // not credited, so the cap is approached from below.
+    float allowance = liveParticles < settings.maxLiveParticles ? static_cast<float>(settings.maxLiveParticles - liveParticles) : 0.0f;
+    for (uint32_t index : order) {
+        ParticleEmitterBudget& budget = *entries[index].budget;
+        if (budget.mode == ParticleUpdateMode::Skip) {
+            continue;
+        }
+        
+        float expected = entries[index].emitter->GetSettings().emissionRate * budget.emissionScale * budget.stepTime;
+        if (expected <= allowance) {
+            allowance -= expected;
+            continue;
+        }
+        
+        budget.emissionScale *= allowance / expected;
+        allowance = 0.0f;
+    }
+}
+
+} // namespace YUGA
@@ -0,0 +1,43 @@
+#include "Rendering/ParticleBuffer.h"
+
+namespace YUGA {
+
+void ParticleBuffer::Reserve(uint32_t newCapacity) {
+    uint32_t blocksPerStream = (newCapacity + StreamAlignment - 1) / StreamAlignment;
+    
+    // Fresh allocation rather than resize: nothing live is kept, and a
+    // smaller emitter should give memory back
+    TrackedVector<Block, MemoryTag::Particles>(static_cast<size_t>(blocksPerStream) * StreamCount).swap(blocks);
+    
+    capacity = newCapacity;
+    stride = blocksPerStream * StreamAlignment;
+    count = 0;
+}
+
+void ParticleBuffer::Kill(uint32_t index) {
+    --count;
+    if (index == count) {
+        return;
+    }
+    
+    // Move the last live particle into the hole
+    float* base = reinterpret_cast<float*>(blocks.data());
+    for (uint32_t stream = 0; stream < StreamCount; ++stream) {
+        float* values = base + stream * stride;
+        values[index] = values[count];
+    }
+}
+
+Particle ParticleBuffer::GetParticle(uint32_t index) const {
+    Particle particle;
+    particle.position = Vector3(Get(PositionX)[index], Get(PositionY)[index], Get(PositionZ)[index]);
+    particle.velocity = Vector3(Get(VelocityX)[index], Get(VelocityY)[index], Get(VelocityZ)[index]);
+    particle.color = Vector4(Get(ColorR)[index], Get(ColorG)[index], Get(ColorB)[index], Get(ColorA)[index]);
+    particle.size = Get(Size)[index];
+    particle.rotation = Get(Rotation)[index];
+    particle.lifetime = Get(Lifetime)[index];
+    particle.age = Get(Age)[index];
+    return particle;
+}
+
+} // namespace YUGA
@@ -0,0 +1,189 @@
+#include "Rendering/ParticleExtractor.h"
+#include "Core/JobSystem.h"
+#include "Rendering/Camera.h"
+#include "Rendering/ParticleWorld.h"
+#include <algorithm>
+#include <bit>
+
+namespace YUGA {
+
+namespace {
+
+// Three passes over the 32-bit depth key
+constexpr uint32_t DigitBits = 11;
+constexpr uint32_t DigitCount = 1u << DigitBits;
+constexpr uint32_t PassCount = (32 + DigitBits - 1) / DigitBits;
+
+uint32_t PackColor(float r, float g, float b, float a) {
+    auto channel = [](float value) {
+        return static_cast<uint32_t>(std::clamp(value, 0.0f, 1.0f) * 255.0f + 0.5f);
+    };
+    return channel(r) | (channel(g) << 8) | (channel(b) << 16) | (channel(a) << 24);
+}
+
+// Orders as the depth descends, so the radix sort's ascending order is
+// back to front
+uint32_t DepthKey(float depth) {
+    uint32_t bits = std::bit_cast<uint32_t>(depth);
+    uint32_t ascending = bits ^ ((bits & 0x80000000u) ? 0xFFFFFFFFu : 0x80000000u);
+    return ~ascending;
+}
+
+uint32_t Digit(uint64_t key, uint32_t pass) {
+    return static_cast<uint32_t>(key >> (32 + pass * DigitBits)) & (DigitCount - 1);
+}
+
+uint32_t BatchCount(uint32_t count) {
+    return (count + ParticleExtractor::ParticlesPerJob - 1) / ParticleExtractor::ParticlesPerJob;
+}
+
+} // namespace
+
+void ParticleExtractor::SetView(const Camera& camera) {
+    SetView(camera.GetTransform().GetPosition(), camera.GetTransform().GetForward());
+}
+
+void ParticleExtractor::SetView(const Vector3& position, const Vector3& forward) {
+    viewPosition = position;
+    viewForward = forward;
+}
+
+void ParticleExtractor::Add(const ParticleSystem& emitter) {
+    sources.push_back(&emitter);
+}
+
+void ParticleExtractor::Add(ParticleWorld& world) {
+    world.ForEachEmitter([this](ParticleEmitterHandle, ParticleSystem& emitter) {
+        Add(emitter);
+    });
+}
+
+uint32_t ParticleExtractor::GetParticleCount() const {
+    uint32_t count = 0;
+    for (const ParticleSystem* source : sources) {
+        count += source->GetParticles().GetCount();
+    }
+    return count;
+}
+
+uint32_t ParticleExtractor::Write(ParticleInstance* destination, uint32_t capacity) {
+    uint32_t count = GetParticleCount();
+    uint32_t written = std::min(count, capacity);
+    if (written == 0) {
+        return 0;
+    }
+    
+    Gather(count);
+    Sort(count);
+    
+    // The nearest particles are last, so a short buffer keeps them
+    const uint64_t* order = keys.data() + (count - written);
+    JobSystem::ParallelFor(written, ParticlesPerJob, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            destination[i] = instances[static_cast<uint32_t>(order[i])];
+        }
+    });
+    return written;
+}
+
+void ParticleExtractor::Gather(uint32_t count) {
+    sourceStarts.clear();
+    uint32_t start = 0;
+    for (const ParticleSystem* source : sources) {
+        sourceStarts.push_back(start);
+        start += source->GetParticles().GetCount();
+    }
+    sourceStarts.push_back(start);
+    
+    instances.resize(count);
+    keys.resize(count);
+    
+    // Each batch finds the source holding its first particle, then walks
+    JobSystem::ParallelFor(BatchCount(count), 1, [&](size_t batchBegin, size_t batchEnd) {
+        uint32_t begin = static_cast<uint32_t>(batchBegin) * ParticlesPerJob;
+        uint32_t end = std::min(static_cast<uint32_t>(batchEnd) * ParticlesPerJob, count);
+        size_t source = std::upper_bound(sourceStarts.begin(), sourceStarts.end(), begin) - sourceStarts.begin() - 1;
+    
+        for (uint32_t index = begin; index < end; ++source) {
+            const ParticleBuffer& particles = sources[source]->GetParticles();
+            const float* positionX = particles.Get(ParticleBuffer::PositionX);
+            const float* positionY = particles.Get(ParticleBuffer::PositionY);
+            const float* positionZ = particles.Get(ParticleBuffer::PositionZ);
+            const float* colorR = particles.Get(ParticleBuffer::ColorR);
+            const float* colorG = particles.Get(ParticleBuffer::ColorG);
+            const float* colorB = particles.Get(ParticleBuffer::ColorB);
+            const float* colorA = particles.Get(ParticleBuffer::ColorA);
+            const float* size = particles.Get(ParticleBuffer::Size);
+            const float* rotation = particles.Get(ParticleBuffer::Rotation);
+    
+            uint32_t first = index - sourceStarts[source];
+            uint32_t last = std::min(end, sourceStarts[source + 1]) - sourceStarts[source];
+            for (uint32_t i = first; i < last; ++i, ++index) {
+                ParticleInstance& instance = instances[index];
+                instance.x = positionX[i];
+                instance.y = positionY[i];
+                instance.z = positionZ[i];
+                instance.size = size[i];
+                instance.rotation = rotation[i];
+                instance.color = PackColor(colorR[i], colorG[i], colorB[i], colorA[i]);
+    
+                float depth = (positionX[i] - viewPosition.x) * viewForward.x
+                            + (positionY[i] - viewPosition.y) * viewForward.y
+                            + (positionZ[i] - viewPosition.z) * viewForward.z;
+                keys[index] = (static_cast<uint64_t>(DepthKey(depth)) << 32) | index;
+            }
+        }
+    });
+}
+
+void ParticleExtractor::Sort(uint32_t count) {
+    uint32_t batchCount = BatchCount(count);
+    sortedKeys.resize(count);
+    histograms.resize(static_cast<size_t>(batchCount) * DigitCount);
+    
+    for (uint32_t pass = 0; pass < PassCount; ++pass) {
+        // Count each batch's digits
+        JobSystem::ParallelFor(batchCount, 1, [&](size_t batchBegin, size_t batchEnd) {
+            for (size_t batch = batchBegin; batch < batchEnd; ++batch) {
+                uint32_t* histogram = histograms.data() + batch * DigitCount;
+                std::fill(histogram, histogram + DigitCount, 0u);
+                uint32_t end = std::min(static_cast<uint32_t>(batch + 1) * ParticlesPerJob, count);
+                for (uint32_t i = static_cast<uint32_t>(batch) * ParticlesPerJob; i < end; ++i) {
+                    ++histogram[Digit(keys[i], pass)];
+                }
+            }
+        });
+    
+        // Turn the counts into each batch's first output slot per digit,
+        // digit-major so equal digits keep batch order. A pass where every
+        // key has the same digit would not move anything.
+        uint32_t offset = 0;
+        bool uniform = false;
+        for (uint32_t digit = 0; digit < DigitCount && !uniform; ++digit) {
+            uint32_t digitStart = offset;
+            for (uint32_t batch = 0; batch < batchCount; ++batch) {
+                uint32_t& slot = histograms[static_cast<size_t>(batch) * DigitCount + digit];
+                uint32_t digitCount = slot;
+                slot = offset;
+                offset += digitCount;
+            }
+            uniform = offset - digitStart == count;
+        }
+        if (uniform) {
+            continue;
+        }
+    
+        JobSystem::ParallelFor(batchCount, 1, [&](size_t batchBegin, size_t batchEnd) {
+            for (size_t batch = batchBegin; batch < batchEnd; ++batch) {
+                uint32_t* next = histograms.data() + batch * DigitCount;
+                uint32_t end = std::min(static_cast<uint32_t>(batch + 1) * ParticlesPerJob, count);
+                for (uint32_t i = static_cast<uint32_t>(batch) * ParticlesPerJob; i < end; ++i) {
+                    sortedKeys[next[Digit(keys[i], pass)]++] = keys[i];
+                }
+            }
+        });
+        keys.swap(sortedKeys);
+    }
+}
+
+} // namespace YUGA
@@ -1,22 +1,277 @@
 #include "Rendering/ParticleSystem.h"
 #include "Math/MathUtils.h"
-#include <cstdlib>
+#include "Math/SIMD.h"
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <limits>
 
 namespace YUGA {
 
+namespace {
+
+// Emitters without a seed of their own are numbered in creation order
+std::atomic<uint32_t> nextInstanceSeed{ 1 };
+
+// Rounds a particle count up to whole SIMD blocks
+uint32_t BlockEnd(uint32_t count) {
+    return (count + Float8::Width - 1) / Float8::Width * Float8::Width;
+}
+
+// Lanes of the block at index block that hold live particles
+uint32_t LiveLanes(uint32_t block, uint32_t count) {
+    return count - block >= Float8::Width ? 0xFFu : (1u << (count - block)) - 1u;
+}
+
+// Lane i holds i + 1, for masking the lanes of a partial block
+alignas(32) const float LaneCounts[Float8::Width] = { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f };
+
+// Gravity, drag, integration, aging and the over-lifetime curves for 8
+// particles at a time, gathering the bounds of the new positions on the
+// way. Lanes past the live range are stream padding or stale slots, so
+// updating them is harmless; they are only kept out of the bounds.
+class BlockIntegrator {
+public:
+    BlockIntegrator(ParticleBuffer& particles, const ParticleEmitterSettings& settings, const ParticleLifetimeTables& tables, float deltaTime)
+        : positionX(particles.Get(ParticleBuffer::PositionX))
+        , positionY(particles.Get(ParticleBuffer::PositionY))
+        , positionZ(particles.Get(ParticleBuffer::PositionZ))
+        , velocityX(particles.Get(ParticleBuffer::VelocityX))
+        , velocityY(particles.Get(ParticleBuffer::VelocityY))
+        , velocityZ(particles.Get(ParticleBuffer::VelocityZ))
+        , color{ particles.Get(ParticleBuffer::ColorR), particles.Get(ParticleBuffer::ColorG),
+                 particles.Get(ParticleBuffer::ColorB), particles.Get(ParticleBuffer::ColorA) }
+        , size(particles.Get(ParticleBuffer::Size))
+        , startSize(particles.Get(ParticleBuffer::StartSize))
+        , rotation(particles.Get(ParticleBuffer::Rotation))
+        , lifetime(particles.Get(ParticleBuffer::Lifetime))
+        , age(particles.Get(ParticleBuffer::Age))
+        , dt(Float8::Broadcast(deltaTime))
+        , gravityX(Float8::Broadcast(settings.gravity.x * deltaTime))
+        , gravityY(Float8::Broadcast(settings.gravity.y * deltaTime))
+        , gravityZ(Float8::Broadcast(settings.gravity.z * deltaTime))
+        , damping(Float8::Broadcast(1.0f - settings.drag * deltaTime))
+        , minX(Float8::Broadcast(std::numeric_limits<float>::infinity()))
+        , minY(minX)
+        , minZ(minX)
+        , maxX(Float8::Broadcast(-std::numeric_limits<float>::infinity()))
+        , maxY(maxX)
+        , maxZ(maxX)
+    {
+        // Constant colors and sizes were set at emission, so only the
+        // others are evaluated; velocity and spin apply unless zero
+        for (int channel = 0; channel < 4; ++channel) {
+            if (!tables.color[channel].constant) {
+                colorOutputs[colorCount] = color[channel];
+                colorCurves[colorCount++] = MakeCurve(tables.color[channel]);
+            }
+        }
+        sized = !tables.size.constant;
+        sizeCurve = MakeCurve(tables.size);
+        
+        drifting = false;
+        for (int axis = 0; axis < 3; ++axis) {
+            drifting |= !tables.velocity[axis].constant || tables.velocity[axis].values[0] != 0.0f;
+            velocityCurves[axis] = MakeCurve(tables.velocity[axis]);
+        }
+        spinning = !tables.rotation.constant || tables.rotation.values[0] != 0.0f;
+        rotationCurve = MakeCurve(tables.rotation);
+        
+        gathered = false;
+        const ParticleCurveTable* all[] = { &tables.color[0], &tables.color[1], &tables.color[2], &tables.color[3],
+                                            &tables.size, &tables.velocity[0], &tables.velocity[1], &tables.velocity[2],
+                                            &tables.rotation };
+        for (const ParticleCurveTable* table : all) {
+            gathered |= !table->linear;
+        }
+        aging = colorCount > 0 || sized || drifting || spinning;
+    }
+    
+    // Advances the block starting at particle index block, where end is
+    // the end of the live range; returns the lanes whose age reached
+    // their lifetime
+    uint32_t Step(uint32_t block, uint32_t end) {
+        Float8 newAge = Float8::Load(age + block) + dt;
+        Float8 life = Float8::Load(lifetime + block);
+        newAge.Store(age + block);
+        
+        Float8 vx = (Float8::Load(velocityX + block) + gravityX) * damping;
+        Float8 vy = (Float8::Load(velocityY + block) + gravityY) * damping;
+        Float8 vz = (Float8::Load(velocityZ + block) + gravityZ) * damping;
+        vx.Store(velocityX + block);
+        vy.Store(velocityY + block);
+        vz.Store(velocityZ + block);
+        
+        // Curves are looked up by normalized age: the sample at or below
+        // it, and how far it is toward the next one. Only the lookup needs
+        // the age clamped; particles past their lifetime die this update.
+        // A zero lifetime gives 0 / 0: Max() keeps its second operand on
+        // NaN, so such lanes read the first sample rather than any index.
+        CurveLookup at{};
+        if (aging) {
+            at.t = newAge / life;
+        }
+        if (gathered) {
+            Float8 x = Float8::Min(Float8::Max(at.t, Float8::Broadcast(0.0f)), Float8::Broadcast(1.0f))
+                     * Float8::Broadcast(ParticleCurveTable::Resolution - 1.0f);
+            at.sample = UInt32x8::Truncate(Float8::Min(x, Float8::Broadcast(ParticleCurveTable::Resolution - 2.0f)));
+            at.weight = x - at.sample.ToFloat8();
+        }
+        
+        // Curve velocity moves the particle but is not kept in its velocity
+        if (drifting) {
+            vx = vx + velocityCurves[0].Evaluate(at);
+            vy = vy + velocityCurves[1].Evaluate(at);
+            vz = vz + velocityCurves[2].Evaluate(at);
+        }
+        Float8 px = Float8::Load(positionX + block) + vx * dt;
+        Float8 py = Float8::Load(positionY + block) + vy * dt;
+        Float8 pz = Float8::Load(positionZ + block) + vz * dt;
+        px.Store(positionX + block);
+        py.Store(positionY + block);
+        pz.Store(positionZ + block);
+        
+        for (uint32_t i = 0; i < colorCount; ++i) {
+            colorCurves[i].Evaluate(at).Store(colorOutputs[i] + block);
+        }
+        if (sized) {
+            (Float8::Load(startSize + block) * sizeCurve.Evaluate(at)).Store(size + block);
+        }
+        if (spinning) {
+            (Float8::Load(rotation + block) + rotationCurve.Evaluate(at) * dt).Store(rotation + block);
+        }
+        
+        if (end - block >= Float8::Width) {
+            minX = Float8::Min(minX, px);
+            minY = Float8::Min(minY, py);
+            minZ = Float8::Min(minZ, pz);
+            maxX = Float8::Max(maxX, px);
+            maxY = Float8::Max(maxY, py);
+            maxZ = Float8::Max(maxZ, pz);
+        } else {
+            // Dead lanes keep the running value
+            Float8 live = Float8::GreaterEqual(Float8::Broadcast(static_cast<float>(end - block)), Float8::Load(LaneCounts));
+            minX = Float8::Select(live, Float8::Min(minX, px), minX);
+            minY = Float8::Select(live, Float8::Min(minY, py), minY);
+            minZ = Float8::Select(live, Float8::Min(minZ, pz), minZ);
+            maxX = Float8::Select(live, Float8::Max(maxX, px), maxX);
+            maxY = Float8::Select(live, Float8::Max(maxY, py), maxY);
+            maxZ = Float8::Select(live, Float8::Max(maxZ, pz), maxZ);
+        }
+        
+        return Float8::MoveMask(Float8::GreaterEqual(newAge, life));
+    }
+    
+    // Bounds of every position stepped so far; min > max when there were none
+    void GetBounds(Vector3& boundsMin, Vector3& boundsMax) const {
+        alignas(32) float lanes[6][Float8::Width];
+        minX.Store(lanes[0]);
+        minY.Store(lanes[1]);
+        minZ.Store(lanes[2]);
+        maxX.Store(lanes[3]);
+        maxY.Store(lanes[4]);
+        maxZ.Store(lanes[5]);
+        
+        boundsMin = Vector3(lanes[0][0], lanes[1][0], lanes[2][0]);
+        boundsMax = Vector3(lanes[3][0], lanes[4][0], lanes[5][0]);
+        for (int lane = 1; lane < Float8::Width; ++lane) {
+            boundsMin = Vector3(std::min(boundsMin.x, lanes[0][lane]), std::min(boundsMin.y, lanes[1][lane]), std::min(boundsMin.z, lanes[2][lane]));
+            boundsMax = Vector3(std::max(boundsMax.x, lanes[3][lane]), std::max(boundsMax.y, lanes[4][lane]), std::max(boundsMax.z, lanes[5][lane]));
+        }
+    }
+    
+private:
+    struct CurveLookup {
+        Float8 t;
+        UInt32x8 sample;
+        Float8 weight;
+    };
+    
+    // A baked curve ready for the update: straight from its line when
+    // linear, else lerped between two gathered samples
+    struct Curve {
+        const float* samples;
+        Float8 start;
+        Float8 slope;
+        
+        Float8 Evaluate(const CurveLookup& at) const {
+            return samples ? Lerp(at) : start + slope * at.t;
+        }
+        
+        Float8 Lerp(const CurveLookup& at) const;
+    };
+    
+    static Curve MakeCurve(const ParticleCurveTable& table) {
+        return { table.linear ? nullptr : table.values, Float8::Broadcast(table.values[0]), Float8::Broadcast(table.slope) };
+    }
+    
+    float* positionX;
+    float* positionY;
+    float* positionZ;
+    float* velocityX;
+    float* velocityY;
+    float* velocityZ;
+    float* color[4];
+    float* size;
+    const float* startSize;
+    float* rotation;
+    const float* lifetime;
+    float* age;
+    
+    Curve colorCurves[4];
+    float* colorOutputs[4];
+    uint32_t colorCount = 0;
+    Curve sizeCurve;
+    Curve velocityCurves[3];
+    Curve rotationCurve;
+    bool sized;
+    bool drifting;
+    bool spinning;
+    bool gathered;
+    bool aging;     // Some curve needs the normalized age
+    
+    Float8 dt;
+    Float8 gravityX;
+    Float8 gravityY;
+    Float8 gravityZ;
+    Float8 damping;
+    
+    Float8 minX, minY, minZ;
+    Float8 maxX, maxY, maxZ;
+};
+
+// Out of line: most curves are linear, and Step() runs faster without
+// the gathers in its body
+Float8 BlockIntegrator::Curve::Lerp(const CurveLookup& at) const {
+    Float8 below = at.sample.Gather(samples);
+    Float8 above = at.sample.Gather(samples + 1);
+    return below + (above - below) * at.weight;
+}
+
+} // namespace
+
 ParticleSystem::ParticleSystem()
     : playing(false)
     , paused(false)
     , time(0.0f)
     , emissionAccumulator(0.0f)
+    , instanceSeed(nextInstanceSeed.fetch_add(1, std::memory_order_relaxed))
+    , maxParticleSize(0.0f)
+    , emissionScale(1.0f)
+    , boundsMin(std::numeric_limits<float>::infinity())
+    , boundsMax(-std::numeric_limits<float>::infinity())
 {
-    particles.resize(100); // Default max particles
+    particles.Reserve(100); // Default max particles
+    ResetRandom();
+    BakeCurves();
 }
 
 void ParticleSystem::Play() {
     playing = true;
     paused = false;
     time = 0.0f;
+    emissionAccumulator = 0.0f;
+    ResetRandom();
 }
 
 void ParticleSystem::Stop() {
@@ -24,10 +279,7 @@ void ParticleSystem::Stop() {
     paused = false;
     time = 0.0f;
     
-    // Deactivate all particles
-    for (auto& particle : particles) {
-        particle.active = false;
-    }
+    Clear();
 }
 
 void ParticleSystem::Pause() {
@@ -35,13 +287,19 @@ void ParticleSystem::Pause() {
 }
 
 void ParticleSystem::Clear() {
-    for (auto& particle : particles) {
-        particle.active = false;
-    }
+    particles.Clear();
+    ResetBounds();
 }
 
 void ParticleSystem::Update(float deltaTime) {
-    if (!playing || paused) return;
+    if (!Advance(deltaTime)) return;
+    
+    // Update existing particles
+    UpdateParticles(deltaTime);
+}
+
+bool ParticleSystem::Advance(float deltaTime) {
+    if (!playing || paused) return false;
     
     time += deltaTime;
     
@@ -51,108 +309,202 @@ void ParticleSystem::Update(float deltaTime) {
             time = 0.0f;
         } else {
             playing = false;
-            return;
+            return false;
         }
     }
     
     // Emit new particles
-    if (playing) {
-        emissionAccumulator += deltaTime * settings.emissionRate;
-        int particlesToEmit = static_cast<int>(emissionAccumulator);
-        emissionAccumulator -= particlesToEmit;
-        
-        for (int i = 0; i < particlesToEmit; ++i) {
-            EmitParticle();
-        }
-    }
+    emissionAccumulator += deltaTime * settings.emissionRate * emissionScale;
+    int particlesToEmit = static_cast<int>(emissionAccumulator);
+    emissionAccumulator -= particlesToEmit;
     
-    // Update existing particles
-    for (auto& particle : particles) {
-        if (particle.active) {
-            UpdateParticle(particle, deltaTime);
-        }
-    }
+    EmitParticles(static_cast<uint32_t>(particlesToEmit));
+    return true;
+}
+
+void ParticleSystem::Emit(int count) {
+    EmitParticles(static_cast<uint32_t>(std::max(count, 0)));
 }
 
 void ParticleSystem::SetSettings(const ParticleEmitterSettings& newSettings) {
     settings = newSettings;
     
-    // Resize particle array if needed
-    if (static_cast<int>(particles.size()) != settings.maxParticles) {
-        particles.resize(settings.maxParticles);
-        for (auto& particle : particles) {
-            particle.active = false;
-        }
+    // Resize particle storage if needed
+    uint32_t capacity = static_cast<uint32_t>(std::max(settings.maxParticles, 0));
+    if (particles.GetCapacity() != capacity) {
+        particles.Reserve(capacity);
     }
+    
+    BakeCurves();
 }
 
-int ParticleSystem::GetActiveParticleCount() const {
-    int count = 0;
-    for (const auto& particle : particles) {
-        if (particle.active) count++;
+void ParticleSystem::BakeCurves() {
+    const float startColor[4] = { settings.startColor.x, settings.startColor.y, settings.startColor.z, settings.startColor.w };
+    for (int channel = 0; channel < 4; ++channel) {
+        lifetimeTables.color[channel].Bake([&](float age) {
+            Vector4 tint = settings.colorOverLifetime.Evaluate(age);
+            const float tintChannels[4] = { tint.x, tint.y, tint.z, tint.w };
+            return startColor[channel] * tintChannels[channel];
+        });
     }
-    return count;
+    
+    lifetimeTables.size.Bake([&](float age) { return settings.sizeOverLifetime.Evaluate(age); });
+    lifetimeTables.velocity[0].Bake([&](float age) { return settings.velocityOverLifetimeX.Evaluate(age); });
+    lifetimeTables.velocity[1].Bake([&](float age) { return settings.velocityOverLifetimeY.Evaluate(age); });
+    lifetimeTables.velocity[2].Bake([&](float age) { return settings.velocityOverLifetimeZ.Evaluate(age); });
+    lifetimeTables.rotation.Bake([&](float age) { return settings.rotationOverLifetime.Evaluate(age) * Math::DEG_TO_RAD; });
+    
+    float largestStart = std::max(std::abs(settings.startSize - settings.sizeVariation), std::abs(settings.startSize + settings.sizeVariation));
+    maxParticleSize = largestStart * std::max(lifetimeTables.size.GetMax(), 0.0f);
 }
 
-void ParticleSystem::EmitParticle() {
-    // Find inactive particle
-    for (auto& particle : particles) {
-        if (!particle.active) {
-            particle.active = true;
-            particle.age = 0.0f;
-            
-            // Set lifetime with variation
-            float lifetimeVar = RandomRange(-settings.lifetimeVariation, settings.lifetimeVariation);
-            particle.lifetime = settings.startLifetime + lifetimeVar;
-            
-            // Set position
-            particle.position = transform.GetPosition() + GetEmissionPosition();
-            
-            // Set velocity
-            particle.velocity = GetEmissionVelocity();
-            
-            // Set size with variation
-            float sizeVar = RandomRange(-settings.sizeVariation, settings.sizeVariation);
-            particle.size = settings.startSize + sizeVar;
-            
-            // Set color
-            particle.color = settings.startColor;
-            
-            break;
-        }
-    }
+void ParticleSystem::ResetRandom() {
+    random.Seed(settings.randomSeed != 0 ? settings.randomSeed : instanceSeed);
 }
 
-void ParticleSystem::UpdateParticle(Particle& particle, float deltaTime) {
-    particle.age += deltaTime;
-    
-    // Check if particle should die
-    if (particle.age >= particle.lifetime) {
-        particle.active = false;
+void ParticleSystem::EmitParticles(uint32_t count) {
+    // Append to the live range; whatever does not fit is dropped
+    uint32_t first = particles.GetCount();
+    count = particles.EmitRange(count);
+    if (count == 0) {
         return;
     }
     
-    // Apply physics
-    particle.velocity += settings.gravity * deltaTime;
-    particle.velocity *= (1.0f - settings.drag * deltaTime);
+    float* positionX = particles.Get(ParticleBuffer::PositionX) + first;
+    float* positionY = particles.Get(ParticleBuffer::PositionY) + first;
+    float* positionZ = particles.Get(ParticleBuffer::PositionZ) + first;
+    float* velocityX = particles.Get(ParticleBuffer::VelocityX) + first;
+    float* velocityY = particles.Get(ParticleBuffer::VelocityY) + first;
+    float* velocityZ = particles.Get(ParticleBuffer::VelocityZ) + first;
+    float* age = particles.Get(ParticleBuffer::Age) + first;
+    
+    // Random numbers are generated a stream at a time. Shape samples land
+    // in the position and velocity streams and are turned into vectors in
+    // place; the age stream holds the speeds until it is reset below.
+    random.Fill(particles.Get(ParticleBuffer::Lifetime) + first, count,
+                settings.startLifetime - settings.lifetimeVariation, settings.startLifetime + settings.lifetimeVariation);
+    random.Fill(particles.Get(ParticleBuffer::StartSize) + first, count,
+                settings.startSize - settings.sizeVariation, settings.startSize + settings.sizeVariation);
+    random.Fill(age, count, settings.startSpeed - settings.speedVariation, settings.startSpeed + settings.speedVariation);
+    
+    bool point = settings.shape == ParticleEmitterSettings::EmissionShape::Point;
+    if (!point) {
+        random.Fill(positionX, count, 0.0f, 1.0f);
+        random.Fill(positionY, count, 0.0f, 1.0f);
+        random.Fill(positionZ, count, 0.0f, 1.0f);
+        random.Fill(velocityX, count, 0.0f, 1.0f);
+        random.Fill(velocityY, count, 0.0f, 1.0f);
+        random.Fill(velocityZ, count, 0.0f, 1.0f);
+    }
+    
+    Vector3 origin = transform.GetPosition();
+    for (uint32_t i = 0; i < count; ++i) {
+        Vector3 offset = point ? Vector3::Zero() : SampleShape(positionX[i], positionY[i], positionZ[i]);
+        Vector3 position = origin + offset;
+        positionX[i] = position.x;
+        positionY[i] = position.y;
+        positionZ[i] = position.z;
+        
+        // Direction from a second shape sample
+        Vector3 direction = point ? Vector3::Zero() : SampleShape(velocityX[i], velocityY[i], velocityZ[i]).Normalized();
+        if (direction.LengthSquared() < 0.001f) {
+            direction = Vector3::Up();
+        }
+        
+        Vector3 velocity = direction * age[i];
+        velocityX[i] = velocity.x;
+        velocityY[i] = velocity.y;
+        velocityZ[i] = velocity.z;
+    }
+    
+    std::fill_n(age, count, 0.0f);
     
-    // Update position
-    particle.position += particle.velocity * deltaTime;
+    // The curves at age 0; constant ones are never written again
+    std::fill_n(particles.Get(ParticleBuffer::ColorR) + first, count, lifetimeTables.color[0].values[0]);
+    std::fill_n(particles.Get(ParticleBuffer::ColorG) + first, count, lifetimeTables.color[1].values[0]);
+    std::fill_n(particles.Get(ParticleBuffer::ColorB) + first, count, lifetimeTables.color[2].values[0]);
+    std::fill_n(particles.Get(ParticleBuffer::ColorA) + first, count, lifetimeTables.color[3].values[0]);
     
-    // Update color/size over lifetime (simple fade)
-    float t = particle.age / particle.lifetime;
-    particle.color.w = 1.0f - t; // Fade out alpha
+    const float* startSize = particles.Get(ParticleBuffer::StartSize) + first;
+    float* size = particles.Get(ParticleBuffer::Size) + first;
+    for (uint32_t i = 0; i < count; ++i) {
+        size[i] = startSize[i] * lifetimeTables.size.values[0];
+    }
+    
+    // Drawn last, so a rotation variation leaves every other stream as it
+    // would be without one
+    float* rotation = particles.Get(ParticleBuffer::Rotation) + first;
+    float startRotation = settings.startRotation * Math::DEG_TO_RAD;
+    if (settings.rotationVariation != 0.0f) {
+        float variation = settings.rotationVariation * Math::DEG_TO_RAD;
+        random.Fill(rotation, count, startRotation - variation, startRotation + variation);
+    } else {
+        std::fill_n(rotation, count, startRotation);
+    }
+}
+
+void ParticleSystem::UpdateParticles(float deltaTime) {
+    // One pass: integrate each block, then kill its dead lanes while they
+    // are still in registers. Blocks run last to first so that the
+    // particle Kill() moves into a hole is already updated and alive.
+    BlockIntegrator integrator(particles, settings, lifetimeTables, deltaTime);
+    uint32_t count = particles.GetCount();
+    for (uint32_t block = BlockEnd(count); block > 0;) {
+        block -= Float8::Width;
+        KillLanes(block, integrator.Step(block, count) & LiveLanes(block, count));
+    }
+    integrator.GetBounds(boundsMin, boundsMax);
+}
+
+void ParticleSystem::SimulateParticles(uint32_t begin, uint32_t end, float deltaTime, Vector3& rangeMin, Vector3& rangeMax) {
+    BlockIntegrator integrator(particles, settings, lifetimeTables, deltaTime);
+    for (uint32_t block = begin; block < BlockEnd(end); block += Float8::Width) {
+        integrator.Step(block, end);
+    }
+    integrator.GetBounds(rangeMin, rangeMax);
 }
 
-Vector3 ParticleSystem::GetEmissionPosition() const {
+void ParticleSystem::KillExpiredParticles() {
+    const float* lifetime = particles.Get(ParticleBuffer::Lifetime);
+    const float* age = particles.Get(ParticleBuffer::Age);
+    
+    uint32_t count = particles.GetCount();
+    for (uint32_t block = BlockEnd(count); block > 0;) {
+        block -= Float8::Width;
+        uint32_t dead = Float8::MoveMask(Float8::GreaterEqual(Float8::Load(age + block), Float8::Load(lifetime + block)));
+        KillLanes(block, dead & LiveLanes(block, count));
+    }
+}
+
+void ParticleSystem::ResetBounds() {
+    boundsMin = Vector3(std::numeric_limits<float>::infinity());
+    boundsMax = Vector3(-std::numeric_limits<float>::infinity());
+}
+
+void ParticleSystem::GrowBounds(const Vector3& min, const Vector3& max) {
+    boundsMin = Vector3(std::min(boundsMin.x, min.x), std::min(boundsMin.y, min.y), std::min(boundsMin.z, min.z));
+    boundsMax = Vector3(std::max(boundsMax.x, max.x), std::max(boundsMax.y, max.y), std::max(boundsMax.z, max.z));
+}
+
+void ParticleSystem::KillLanes(uint32_t block, uint32_t lanes) {
+    // Highest lane first, for the same reason blocks run top down
+    while (lanes) {
+        uint32_t lane = 31u - static_cast<uint32_t>(std::countl_zero(lanes));
+        particles.Kill(block + lane);
+        lanes &= ~(1u << lane);
+    }
+}
+
+Vector3 ParticleSystem::SampleShape(float u0, float u1, float u2) const {
+    // u0, u1 and u2 are uniform in [0, 1)
     switch (settings.shape) {
         case ParticleEmitterSettings::EmissionShape::Point:
             return Vector3::Zero();
             
         case ParticleEmitterSettings::EmissionShape::Sphere: {
-            float theta = RandomRange(0.0f, Math::TWO_PI);
-            float phi = RandomRange(0.0f, Math::PI);
-            float r = RandomRange(0.0f, settings.shapeRadius);
+            float theta = u0 * Math::TWO_PI;
+            float phi = u1 * Math::PI;
+            float r = u2 * settings.shapeRadius;
             
             return Vector3(
                 r * Math::Sin(phi) * Math::Cos(theta),
@@ -163,41 +515,24 @@ Vector3 ParticleSystem::GetEmissionPosition() const {
         
         case ParticleEmitterSettings::EmissionShape::Box:
             return Vector3(
-                RandomRange(-settings.shapeSize.x * 0.5f, settings.shapeSize.x * 0.5f),
-                RandomRange(-settings.shapeSize.y * 0.5f, settings.shapeSize.y * 0.5f),
-                RandomRange(-settings.shapeSize.z * 0.5f, settings.shapeSize.z * 0.5f)
+                (u0 - 0.5f) * settings.shapeSize.x,
+                (u1 - 0.5f) * settings.shapeSize.y,
+                (u2 - 0.5f) * settings.shapeSize.z
             );
             
         case ParticleEmitterSettings::EmissionShape::Cone: {
-            float angle = RandomRange(0.0f, settings.coneAngle * Math::DEG_TO_RAD);
-            float rotation = RandomRange(0.0f, Math::TWO_PI);
+            float angle = u0 * settings.coneAngle * Math::DEG_TO_RAD;
+            float rotation = u1 * Math::TWO_PI;
             
             return Vector3(
                 Math::Sin(angle) * Math::Cos(rotation),
                 Math::Cos(angle),
                 Math::Sin(angle) * Math::Sin(rotation)
-            ) * RandomRange(0.0f, settings.shapeRadius);
+            ) * (u2 * settings.shapeRadius);
         }
     }
     
     return Vector3::Zero();
 }
 
-Vector3 ParticleSystem::GetEmissionVelocity() const {
-    Vector3 direction = GetEmissionPosition().Normalized();
-    if (direction.LengthSquared() < 0.001f) {
-        direction = Vector3::Up();
-    }
-    
-    float speedVar = RandomRange(-settings.speedVariation, settings.speedVariation);
-    float speed = settings.startSpeed + speedVar;
-    
-    return direction * speed;
-}
-
-float ParticleSystem::RandomRange(float min, float max) const {
-    float t = static_cast<float>(rand()) / static_cast<float>(RAND_MAX);
-    return min + t * (max - min);
-}
-
 } // namespace YUGA
@@ -0,0 +1,162 @@
+#include "Rendering/ParticleWorld.h"
+#include "Core/JobSystem.h"
+#include <algorithm>
+#include <chrono>
+
+namespace YUGA {
+
+namespace {
+
+// Emitters per batch for the per-emitter steps
+constexpr size_t EmittersPerBatch = 16;
+
+} // namespace
+
+ParticleEmitterHandle ParticleWorld::CreateEmitter(const ParticleEmitterSettings& settings) {
+    Ref<ParticleSystem> emitter = CreateRef<ParticleSystem>();
+    if (!emitter) {
+        return {};
+    }
+    
+    emitter->SetSettings(settings);
+    ParticleEmitterHandle handle = emitters.Add(std::move(emitter));
+    if (!handle) {
+        return {};
+    }
+    
+    uint32_t slot = handle.GetIndex();
+    if (slot >= budgets.size()) {
+        budgets.resize(slot + 1);
+    }
+    budgets[slot] = ParticleEmitterBudget();
+    return handle;
+}
+
+void ParticleWorld::DestroyEmitter(ParticleEmitterHandle handle) {
+    emitters.Remove(handle);
+}
+
+void ParticleWorld::Clear() {
+    emitters.Clear();
+    stats = {};
+}
+
+ParticleSystem* ParticleWorld::GetEmitter(ParticleEmitterHandle handle) {
+    return emitters.Resolve(handle);
+}
+
+const ParticleSystem* ParticleWorld::GetEmitter(ParticleEmitterHandle handle) const {
+    return emitters.Resolve(handle);
+}
+
+void ParticleWorld::ForEachEmitter(const std::function<void(ParticleEmitterHandle, ParticleSystem&)>& callback) {
+    emitters.ForEach([&](ParticleEmitterHandle handle, const Ref<ParticleSystem>& emitter) {
+        callback(handle, *emitter);
+    });
+}
+
+void ParticleWorld::Update(float deltaTime) {
+    auto start = std::chrono::steady_clock::now();
+    
+    entries.clear();
+    emitters.ForEach([this](ParticleEmitterHandle handle, const Ref<ParticleSystem>& emitter) {
+        entries.push_back({ emitter.get(), &budgets[handle.GetIndex()] });
+    });
+    
+    // Serial, but only a few bounds tests per emitter
+    budget.Plan(entries, stats.liveParticles, deltaTime);
+    
+    // Clocks and emission; every emitter has its own random stream.
+    // Catch-ups run whole here, in small steps, since they are rare and
+    // each needs several updates in a row.
+    advanced.assign(entries.size(), 0);
+    float catchUpStep = std::max(budget.GetSettings().catchUpStep, deltaTime);
+    JobSystem::ParallelFor(entries.size(), EmittersPerBatch, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            ParticleSystem* emitter = entries[i].emitter;
+            const ParticleEmitterBudget& plan = *entries[i].budget;
+            emitter->emissionScale = plan.emissionScale;
+            
+            if (plan.mode == ParticleUpdateMode::Normal) {
+                advanced[i] = emitter->Advance(deltaTime);
+            } else if (plan.mode == ParticleUpdateMode::CatchUp) {
+                for (float remaining = plan.stepTime; remaining > 0.0f; remaining -= catchUpStep) {
+                    emitter->Update(std::min(remaining, catchUpStep));
+                }
+            }
+        }
+    });
+    
+    simulated.clear();
+    for (size_t i = 0; i < entries.size(); ++i) {
+        if (advanced[i]) {
+            simulated.push_back(entries[i].emitter);
+        }
+    }
+    
+    // Integration, in batches of equal particle counts
+    BuildSimulationJobs();
+    JobSystem::ParallelFor(jobStarts.size() - 1, 1, [&](size_t begin, size_t end) {
+        for (size_t job = begin; job < end; ++job) {
+            for (uint32_t r = jobStarts[job]; r < jobStarts[job + 1]; ++r) {
+                SimulationRange& range = ranges[r];
+                range.emitter->SimulateParticles(range.begin, range.end, deltaTime, range.boundsMin, range.boundsMax);
+            }
+        }
+    });
+    
+    for (ParticleSystem* emitter : simulated) {
+        emitter->ResetBounds();
+    }
+    for (const SimulationRange& range : ranges) {
+        range.emitter->GrowBounds(range.boundsMin, range.boundsMax);
+    }
+    
+    // Compaction touches a whole buffer, so it stays per emitter
+    JobSystem::ParallelFor(simulated.size(), EmittersPerBatch, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            simulated[i]->KillExpiredParticles();
+        }
+    });
+    
+    stats.emitters = GetEmitterCount();
+    stats.activeEmitters = static_cast<uint32_t>(simulated.size());
+    stats.liveParticles = 0;
+    for (const ParticleBudgetEntry& entry : entries) {
+        stats.liveParticles += entry.emitter->particles.GetCount();
+    }
+    stats.simulationJobs = static_cast<uint32_t>(jobStarts.size() - 1);
+    stats.updateMilliseconds = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+void ParticleWorld::BuildSimulationJobs() {
+    // Walks the emitters' live ranges and cuts a job every ParticlesPerJob
+    // particles; a large emitter spans several jobs, small ones share one
+    ranges.clear();
+    jobStarts.clear();
+    jobStarts.push_back(0);
+    
+    uint32_t jobParticles = 0;
+    for (ParticleSystem* emitter : simulated) {
+        uint32_t count = emitter->particles.GetCount();
+        for (uint32_t begin = 0; begin < count;) {
+            uint32_t end = std::min(count, begin + (ParticlesPerJob - jobParticles));
+            ranges.push_back({ emitter, begin, end, Vector3(), Vector3() });
+    
+            // Count whole blocks, which is what the SIMD loop runs
+            uint32_t blocks = (end - begin + ParticleBuffer::StreamAlignment - 1) / ParticleBuffer::StreamAlignment;
+            jobParticles += blocks * ParticleBuffer::StreamAlignment;
+            if (jobParticles >= ParticlesPerJob) {
+                jobStarts.push_back(static_cast<uint32_t>(ranges.size()));
+                jobParticles = 0;
+            }
+            begin = end;
+        }
+    }
+    
+    if (jobStarts.back() != ranges.size()) {
+        jobStarts.push_back(static_cast<uint32_t>(ranges.size()));
+    }
+}
+
+} // namespace YUGA
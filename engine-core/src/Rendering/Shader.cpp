@@ -67,32 +67,33 @@ uint32_t Shader::CompileShader(uint32_t type, const std::string& source) {
     return 0; // Stub
 }
 
-void Shader::SetInt(const std::string& name, int value) {
+void Shader::SetInt(Name name, int value) {
     // TODO: Set uniform
     // glUniform1i(GetUniformLocation(name), value);
 }
 
-void Shader::SetFloat(const std::string& name, float value) {
+void Shader::SetFloat(Name name, float value) {
     // TODO: Set uniform
     // glUniform1f(GetUniformLocation(name), value);
 }
 
-void Shader::SetFloat3(const std::string& name, const Vector3& value) {
+void Shader::SetFloat3(Name name, const Vector3& value) {
     // TODO: Set uniform
     // glUniform3f(GetUniformLocation(name), value.x, value.y, value.z);
 }
 
-void Shader::SetFloat4(const std::string& name, float x, float y, float z, float w) {
+void Shader::SetFloat4(Name name, float x, float y, float z, float w) {
     // TODO: Set uniform
     // glUniform4f(GetUniformLocation(name), x, y, z, w);
 }
 
-int Shader::GetUniformLocation(const std::string& name) {
-    if (m_UniformLocationCache.find(name) != m_UniformLocationCache.end())
-        return m_UniformLocationCache[name];
+int Shader::GetUniformLocation(Name name) {
+    auto it = m_UniformLocationCache.find(name);
+    if (it != m_UniformLocationCache.end())
+        return it->second;
     
-    // TODO: Get uniform location
-    // int location = glGetUniformLocation(m_RendererID, name.c_str());
+    // TODO: Get uniform location (cache miss only, needs the interned string)
+    // int location = glGetUniformLocation(m_RendererID, name.ToString().c_str());
     // m_UniformLocationCache[name] = location;
     // return location;
     
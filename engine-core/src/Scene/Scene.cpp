@@ -1,11 +1,15 @@
 #include "Scene/Scene.h"
 #include "ECS/Components.h"
+#include "Assets/AssetManager.h"
+#include "Physics/PhysicsSystem.h"
+#include "Physics/TriggerSystem.h"
 #include "Core/Log.h"
 
 namespace YUGA {
     
     Scene::Scene(const std::string& name)
         : m_Name(name) {
+        m_TriggerSystem = CreateScope<TriggerSystem>(m_Registry);
         Log::Info("Scene created: " + name);
     }
     
@@ -24,9 +28,30 @@ namespace YUGA {
         m_Registry.destroy(entity);
     }
     
+    void Scene::SetPhysicsWorld(PhysicsWorld* world) {
+        if (world) {
+            m_PhysicsSystem = CreateScope<PhysicsSystem>(*world, m_Registry);
+        } else {
+            m_PhysicsSystem.reset();
+        }
+    }
+    
     void Scene::OnUpdate(float deltaTime) {
+        // Fixed sync point: pull the transforms published by the last physics step
+        if (m_PhysicsSystem) {
+            m_PhysicsSystem->PullTransforms();
+        }
+        
+        // Enter/stay/exit against the transforms bodies just reached
+        m_TriggerSystem->Update();
+        
         // Update all systems here
-        // Physics, scripts, etc.
+        // Scripts, etc.
+        
+        // Hand this frame's body changes to the next physics step
+        if (m_PhysicsSystem) {
+            m_PhysicsSystem->PushTransforms();
+        }
     }
     
     void Scene::OnRender() {
@@ -35,6 +60,11 @@ namespace YUGA {
         for (auto entity : view) {
             auto& transform = view.get<TransformComponent>(entity);
             auto& mesh = view.get<MeshComponent>(entity);
+            
+            Model* model = AssetManager::Get().GetModel(mesh.MeshId);
+            if (!model) {
+                continue; // Unset or unloaded asset
+            }
             // Render mesh at transform position
         }
     }
@@ -1,5 +1,7 @@
 #include "Scripting/ScriptEngine.h"
 #include "Core/Log.h"
+#include "Memory/MemoryTracker.h"
+#include <cstdlib>
 #include <fstream>
 #include <sstream>
 
@@ -8,7 +10,7 @@ namespace YUGA {
     lua_State* ScriptEngine::s_LuaState = nullptr;
     
     void ScriptEngine::Initialize() {
-        s_LuaState = luaL_newstate();
+        s_LuaState = lua_newstate(LuaAllocator, nullptr);
         luaL_openlibs(s_LuaState);
         
         RegisterEngineFunctions();
@@ -90,6 +92,34 @@ namespace YUGA {
         Log::Info("Script reloaded: " + filepath);
     }
     
+    void* ScriptEngine::LuaAllocator(void* userData, void* ptr, size_t oldSize, size_t newSize) {
+        // When ptr is null, oldSize encodes the Lua object type, not a size
+        size_t currentSize = ptr ? oldSize : 0;
+        
+        if (newSize == 0) {
+            std::free(ptr);
+            MemoryTracker::RecordFree(MemoryTag::Scripting, currentSize);
+            return nullptr;
+        }
+        
+        if (newSize > currentSize && !MemoryTracker::RecordAllocation(MemoryTag::Scripting, newSize - currentSize)) {
+            return nullptr; // Lua raises a memory error
+        }
+        
+        void* block = std::realloc(ptr, newSize);
+        if (!block) {
+            if (newSize > currentSize) {
+                MemoryTracker::RecordFree(MemoryTag::Scripting, newSize - currentSize);
+            }
+            return nullptr;
+        }
+        
+        if (newSize < currentSize) {
+            MemoryTracker::RecordFree(MemoryTag::Scripting, currentSize - newSize);
+        }
+        return block;
+    }
+    
     void ScriptEngine::RegisterEngineFunctions() {
         // Register C++ functions to Lua
         // Example: Log function
@@ -16,7 +16,27 @@ Terrain::Terrain(int width, int height, float scale)
 
 void Terrain::SetHeight(int x, int z, float height) {
     if (IsValid(x, z)) {
+        NotifyChanging();
         heightData[GetIndex(x, z)] = height;
+        NotifyChanged(x, z, x, z);
+    }
+}
+
+void Terrain::SetScale(float newScale) {
+    NotifyChanging();
+    scale = newScale;
+    NotifyChanged(0, 0, width - 1, height - 1);
+}
+
+void Terrain::NotifyChanging() const {
+    if (listener) {
+        listener->OnHeightsChanging(*this);
+    }
+}
+
+void Terrain::NotifyChanged(int minX, int minZ, int maxX, int maxZ) const {
+    if (listener && minX <= maxX && minZ <= maxZ) {
+        listener->OnHeightsChanged(*this, minX, minZ, maxX, maxZ);
     }
 }
 
@@ -57,6 +77,7 @@ float Terrain::GetHeightAtPosition(float worldX, float worldZ) const {
 void Terrain::GenerateHeightmap(int seed) {
     // Simple Perlin-like noise generation
     srand(seed);
+    NotifyChanging();
     
     for (int z = 0; z < height; ++z) {
         for (int x = 0; x < width; ++x) {
@@ -83,12 +104,15 @@ void Terrain::GenerateHeightmap(int seed) {
             // Scale height
             h = (h + 1.0f) * 0.5f * 10.0f; // Height range 0-10
             
-            SetHeight(x, z, h);
+            heightData[GetIndex(x, z)] = h;
         }
     }
+    
+    NotifyChanged(0, 0, width - 1, height - 1);
 }
 
 void Terrain::GenerateMesh() {
+    // Load-time scratch; too large for the frame arena on any real terrain
     std::vector<float> vertices;
     std::vector<float> normals;
     std::vector<float> texCoords;
@@ -97,7 +121,7 @@ void Terrain::GenerateMesh() {
     GenerateVertices(vertices, normals, texCoords, indices);
     
     // Create mesh (simplified - you'd use your actual Mesh class)
-    mesh = std::make_shared<Mesh>();
+    mesh = CreateRef<Mesh>();
     // mesh->SetVertices(vertices);
     // mesh->SetNormals(normals);
     // mesh->SetTexCoords(texCoords);
@@ -106,45 +130,55 @@ void Terrain::GenerateMesh() {
 
 void Terrain::GenerateVertices(std::vector<float>& vertices, std::vector<float>& normals,
                                std::vector<float>& texCoords, std::vector<unsigned int>& indices) {
+    size_t vertexCount = static_cast<size_t>(width) * height;
+    size_t quadCount = static_cast<size_t>(std::max(width - 1, 0)) * std::max(height - 1, 0);
+    
+    vertices.resize(vertexCount * 3);
+    normals.resize(vertexCount * 3);
+    texCoords.resize(vertexCount * 2);
+    indices.resize(quadCount * 6);
+    
     // Generate vertices
     for (int z = 0; z < height; ++z) {
         for (int x = 0; x < width; ++x) {
-            float h = GetHeight(x, z);
+            size_t v = static_cast<size_t>(GetIndex(x, z));
+            float h = heightData[v];
             
             // Position
-            vertices.push_back(x * scale);
-            vertices.push_back(h);
-            vertices.push_back(z * scale);
+            vertices[v * 3 + 0] = x * scale;
+            vertices[v * 3 + 1] = h;
+            vertices[v * 3 + 2] = z * scale;
             
             // Normal
             Vector3 normal = GetNormal(x, z);
-            normals.push_back(normal.x);
-            normals.push_back(normal.y);
-            normals.push_back(normal.z);
+            normals[v * 3 + 0] = normal.x;
+            normals[v * 3 + 1] = normal.y;
+            normals[v * 3 + 2] = normal.z;
             
             // Texture coordinates
-            texCoords.push_back(static_cast<float>(x) / (width - 1));
-            texCoords.push_back(static_cast<float>(z) / (height - 1));
+            texCoords[v * 2 + 0] = static_cast<float>(x) / (width - 1);
+            texCoords[v * 2 + 1] = static_cast<float>(z) / (height - 1);
         }
     }
     
     // Generate indices
+    size_t i = 0;
     for (int z = 0; z < height - 1; ++z) {
         for (int x = 0; x < width - 1; ++x) {
-            int topLeft = z * width + x;
-            int topRight = topLeft + 1;
-            int bottomLeft = (z + 1) * width + x;
-            int bottomRight = bottomLeft + 1;
+            unsigned int topLeft = z * width + x;
+            unsigned int topRight = topLeft + 1;
+            unsigned int bottomLeft = (z + 1) * width + x;
+            unsigned int bottomRight = bottomLeft + 1;
             
             // First triangle
-            indices.push_back(topLeft);
-            indices.push_back(bottomLeft);
-            indices.push_back(topRight);
+            indices[i++] = topLeft;
+            indices[i++] = bottomLeft;
+            indices[i++] = topRight;
             
             // Second triangle
-            indices.push_back(topRight);
-            indices.push_back(bottomLeft);
-            indices.push_back(bottomRight);
+            indices[i++] = topRight;
+            indices[i++] = bottomLeft;
+            indices[i++] = bottomRight;
         }
     }
 }
@@ -164,13 +198,13 @@ Vector3 Terrain::GetNormal(int x, int z) const {
     return normal.Normalized();
 }
 
-void Terrain::SetTexture(int layer, std::shared_ptr<Texture> texture) {
+void Terrain::SetTexture(int layer, Ref<Texture> texture) {
     if (layer >= 0 && layer < static_cast<int>(textures.size())) {
         textures[layer] = texture;
     }
 }
 
-std::shared_ptr<Texture> Terrain::GetTexture(int layer) const {
+Ref<Texture> Terrain::GetTexture(int layer) const {
     if (layer >= 0 && layer < static_cast<int>(textures.size())) {
         return textures[layer];
     }
@@ -183,10 +217,16 @@ void Terrain::Paint(float worldX, float worldZ, int layer, float radius, float s
     int centerZ = static_cast<int>(worldZ / scale);
     int radiusInt = static_cast<int>(radius / scale);
     
+    // Brush footprint clipped to the terrain; listeners hear about it once
+    int minX = std::max(centerX - radiusInt, 0);
+    int minZ = std::max(centerZ - radiusInt, 0);
+    int maxX = std::min(centerX + radiusInt, width - 1);
+    int maxZ = std::min(centerZ + radiusInt, height - 1);
+    NotifyChanging();
+    
     // Paint in circular area
-    for (int z = centerZ - radiusInt; z <= centerZ + radiusInt; ++z) {
-        for (int x = centerX - radiusInt; x <= centerX + radiusInt; ++x) {
-            if (!IsValid(x, z)) continue;
+    for (int z = minZ; z <= maxZ; ++z) {
+        for (int x = minX; x <= maxX; ++x) {
             
             // Calculate distance from center
             float dx = (x - centerX) * scale;
@@ -199,13 +239,13 @@ void Terrain::Paint(float worldX, float worldZ, int layer, float radius, float s
                 falloff = Math::SmoothStep(0.0f, 1.0f, falloff);
                 
                 // Modify height (or texture weight in a real implementation)
-                float currentHeight = GetHeight(x, z);
-                float newHeight = currentHeight + strength * falloff;
-                SetHeight(x, z, newHeight);
+                heightData[GetIndex(x, z)] += strength * falloff;
             }
         }
     }
     
+    NotifyChanged(minX, minZ, maxX, maxZ);
+    
     // Regenerate mesh after painting
     GenerateMesh();
 }
@@ -62,13 +62,13 @@ void UICanvas::Render() {
     }
 }
 
-void UICanvas::AddElement(std::shared_ptr<UIElement> element) {
+void UICanvas::AddElement(Ref<UIElement> element) {
     if (element) {
         elements.push_back(element);
     }
 }
 
-void UICanvas::RemoveElement(std::shared_ptr<UIElement> element) {
+void UICanvas::RemoveElement(Ref<UIElement> element) {
     auto it = std::find(elements.begin(), elements.end(), element);
     if (it != elements.end()) {
         elements.erase(it);
@@ -1,5 +1,6 @@
 #include "Workflow/WorkflowManager.h"
 #include "Core/Log.h"
+#include "Core/EventBus.h"
 #include <sstream>
 
 namespace YUGA {
@@ -276,6 +277,13 @@ void WorkflowManager::StartAIBrainstorm(const std::string& topic) {
 }
 
 // Workflow State
+void WorkflowManager::SetCurrentStep(WorkflowStep step) {
+    if (step != currentStep) {
+        currentStep = step;
+        EventBus::Publish<WorkflowStepChangedEvent>(step);
+    }
+}
+
 float WorkflowManager::GetProjectProgress() const {
     int stepCount = 8;
     int currentStepIndex = static_cast<int>(currentStep);
@@ -285,16 +293,12 @@ float WorkflowManager::GetProjectProgress() const {
 // Helper methods
 void WorkflowManager::Log(const std::string& message) {
     LOG_INFO(message);
-    if (onLog) {
-        onLog(message);
-    }
+    EventBus::Publish<WorkflowLogEvent>(message, false);
 }
 
 void WorkflowManager::Error(const std::string& error) {
     LOG_ERROR(error);
-    if (onError) {
-        onError(error);
-    }
+    EventBus::Publish<WorkflowLogEvent>(error, true);
 }
 
 bool WorkflowManager::ConnectToAIBackend() {